@@ -27,15 +27,15 @@ uniform float pointDiffuseIntensity; // 0..1
 
 // Additional point lights (e.g. indoor fixtures)
 uniform int pointLightCount;
-uniform int lightsPerBuilding; // e.g. 8
 // Rects used to decide which building we're inside for indoor lighting
 uniform int lightRectCount;
 // vec4(minX, minZ, maxX, maxZ)
 uniform vec4 lightRects[8];
-// Packed lights: grouped per building, contiguous.
-// vec4(x,y,z,radius)
-uniform vec4 pointLightsPosRadius[64];
-uniform vec3 pointLightsColor[64];
+// Lights belonging to each light rect: ivec2(first light, light count)
+uniform ivec2 lightRanges[8];
+// Packed lights: grouped per building, contiguous, two vec4 per light.
+// [2 * i] = vec4(x,y,z,radius), [2 * i + 1] = vec4(r,g,b,unused)
+uniform vec4 pointLights[128];
 
 // Shading model controls
 uniform float shininess;      // e.g. 16..128
@@ -132,16 +132,16 @@ void main()
 
     // Indoor point lights:
     // - Determine which building we are inside (using lightRects, which can be tighter than roofRects)
-    // - Only iterate that building's lights (perf: 8 instead of 48)
+    // - Only iterate that building's lights (perf: 10 instead of 60)
     int idx = getLightRectIndex(fragPosition);
-    if (idx >= 0 && lightsPerBuilding > 0)
+    if (idx >= 0)
     {
-        int base = idx * lightsPerBuilding;
-        for (int i = 0; i < lightsPerBuilding; i++)
+        ivec2 range = lightRanges[idx];
+        for (int i = 0; i < range.y; i++)
         {
-            int li = base + i;
+            int li = range.x + i;
             if (li >= pointLightCount) break;
-            lit += apply_point_light(albedo.rgb, N, fragPosition, pointLightsPosRadius[li], pointLightsColor[li]);
+            lit += apply_point_light(albedo.rgb, N, fragPosition, pointLights[2 * li], pointLights[2 * li + 1].rgb);
         }
     }
 
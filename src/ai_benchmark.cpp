@@ -0,0 +1,201 @@
+#include "ai_benchmark.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <new>
+#include <vector>
+
+#include "components/has_day_night_timer.h"
+#include "components/is_spawner.h"
+#include "engine/log.h"
+#include "engine/path_request_manager.h"
+#include "engine/statemanager.h"
+#include "engine/thread_role.h"
+#include "entities/entity_helper.h"
+#include "entities/entity_query.h"
+#include "entities/singleton_component.h"
+#include "map.h"
+#include "system/ai/ai_decision_scheduler.h"
+#include "system/core/system_groups.h"
+
+namespace {
+// Only counted while the benchmark loop runs
+std::atomic<bool> counting_allocations{false};
+std::atomic<uint64_t> num_allocations{0};
+}  // namespace
+
+// Only `make benchai` sets this, it builds its own exe so the game keeps the
+// normal allocator
+#ifdef BENCH_AI_COUNT_ALLOCATIONS
+void* operator new(std::size_t size) {
+    if (counting_allocations.load(std::memory_order_relaxed)) {
+        num_allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+#endif
+
+namespace ai_benchmark {
+
+namespace {
+// Same rate the server thread ticks at
+constexpr float DT = 1.f / 120.f;
+// Seconds between customers once the bar opens
+constexpr float SPAWN_SPREAD = 1.f;
+// Way past any sane day length, only here so a stuck day cant hang forever
+constexpr float MAX_SIM_SECONDS_PER_DAY = 60.f * 60.f;
+constexpr size_t NUM_SYSTEMS_SHOWN = 20;
+
+void fill_customer_spawner(int customers, bool reset) {
+    OptEntity spawner =
+        EQ().whereType(EntityType::CustomerSpawner).gen_first();
+    if (!spawner) {
+        log_warn("ai benchmark: no customer spawner on this map");
+        return;
+    }
+    IsSpawner& iss = spawner->get<IsSpawner>();
+    // Round settings set their own total when the night starts, keep
+    // putting ours back
+    if (iss.get_max_spawned() != customers) iss.set_total(customers);
+    if (reset) iss.set_time_between(SPAWN_SPREAD).reset_num_spawned();
+}
+}  // namespace
+
+int run(const Config& config) {
+    thread_role::set(thread_role::Role::Server);
+    afterhours::EntityHelper::set_default_collection(
+        &EntityHelper::get_server_collection());
+
+    // Path answers come back the tick they were asked for instead of
+    // whenever the path thread gets to them
+    PathRequestManager::start_inline();
+    // A wall clock budget would make who gets to decide depend on how fast
+    // the machine is
+    system_manager::ai::decisions::set_budget_ms(
+        std::numeric_limits<float>::max());
+
+    // Seeds RandomEngine, the map itself is generated on the first update
+    // which is left out of the numbers
+    Map map(config.seed);
+    GameState::get().transition_to_game();
+    const std::vector<std::shared_ptr<Entity>> no_players;
+    map._onUpdate(no_players, DT);
+
+    std::vector<double> system_ms;
+    std::vector<double> group_ms(system_groups::group_timings().size(), 0.0);
+
+    const uint64_t max_ticks =
+        (uint64_t) (MAX_SIM_SECONDS_PER_DAY * (float) config.days / DT);
+    uint64_t ticks = 0;
+    uint64_t path_requests = 0;
+    int start_day = -1;
+    bool was_open = false;
+    bool finished = false;
+
+    num_allocations.store(0);
+    counting_allocations.store(true);
+    auto wall_start = std::chrono::steady_clock::now();
+
+    while (ticks < max_ticks) {
+        map._onUpdate(no_players, DT);
+        path_requests += PathRequestManager::process_requests_inline();
+        ticks++;
+
+        const std::deque<system_groups::Timing>& timings =
+            system_groups::system_timings();
+        if (system_ms.size() < timings.size()) {
+            system_ms.resize(timings.size(), 0.0);
+        }
+        for (size_t i = 0; i < timings.size(); i++) {
+            system_ms[i] += timings[i].last_ms.load(std::memory_order_relaxed);
+        }
+        for (size_t i = 0; i < group_ms.size(); i++) {
+            group_ms[i] += system_groups::group_timings()[i].last_ms.load(
+                std::memory_order_relaxed);
+        }
+
+        const HasDayNightTimer* timer = Singleton<HasDayNightTimer>::get_ptr();
+        if (!timer) continue;
+        if (start_day < 0) start_day = timer->days_passed();
+
+        bool open = timer->is_bar_open();
+        if (open) fill_customer_spawner(config.customers, !was_open);
+        was_open = open;
+
+        if (!open && timer->days_passed() - start_day >= config.days) {
+            finished = true;
+            break;
+        }
+    }
+
+    double wall_s = std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - wall_start)
+                        .count();
+    counting_allocations.store(false);
+    uint64_t allocations = num_allocations.load();
+    PathRequestManager::stop();
+
+    double sim_s = (double) ticks * DT;
+    double num_ticks = (double) std::max<uint64_t>(1, ticks);
+    size_t num_entities = EntityHelper::get_entities().size();
+
+    std::cout << "[bench-ai] seed=" << config.seed
+              << " customers=" << config.customers << " days=" << config.days
+              << (finished ? "" : " (hit the tick limit)") << std::endl;
+    std::cout << fmt::format(
+                     "[bench-ai] ticks {} sim {:.1f}s wall {:.2f}s ({:.0f} "
+                     "ticks/s) entities at end {}",
+                     ticks, sim_s, wall_s, (double) ticks / wall_s,
+                     num_entities)
+              << std::endl;
+    std::cout << fmt::format(
+                     "[bench-ai] path requests {} ({:.1f}/sim s, {:.0f}/wall "
+                     "s), path cache hit rate {:.0f}%",
+                     path_requests, (double) path_requests / sim_s,
+                     (double) path_requests / wall_s,
+                     100.f * PathCache::get_stats().hit_rate())
+              << std::endl;
+#ifdef BENCH_AI_COUNT_ALLOCATIONS
+    std::cout << fmt::format("[bench-ai] allocations {} ({:.1f}/tick)",
+                             allocations, (double) allocations / num_ticks)
+              << std::endl;
+#else
+    (void) allocations;
+    std::cout << "[bench-ai] allocations not counted, use make benchai"
+              << std::endl;
+#endif
+
+    const auto print_timing = [&](const std::string& name, double total_ms) {
+        std::cout << fmt::format("[bench-ai]   {:<48} {:9.3f}ms {:8.4f}ms/tick",
+                                 name, total_ms, total_ms / num_ticks)
+                  << std::endl;
+    };
+
+    std::cout << "[bench-ai] groups" << std::endl;
+    for (size_t i = 0; i < group_ms.size(); i++) {
+        print_timing(system_groups::group_timings()[i].name, group_ms[i]);
+    }
+
+    std::vector<size_t> order(system_ms.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = i;
+    std::sort(order.begin(), order.end(),
+              [&](size_t a, size_t b) { return system_ms[a] > system_ms[b]; });
+    if (order.size() > NUM_SYSTEMS_SHOWN) order.resize(NUM_SYSTEMS_SHOWN);
+
+    std::cout << "[bench-ai] slowest systems" << std::endl;
+    for (size_t i : order) {
+        print_timing(system_groups::system_timings()[i].name, system_ms[i]);
+    }
+
+    return finished ? 0 : 1;
+}
+
+}  // namespace ai_benchmark
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+
+// Headless customer load benchmark (--bench-ai)
+//
+// Builds the in game bar for a seed, runs the server side systems at a fixed
+// dt with pathfinding answered on the same thread, and has the customer
+// spawner send `customers` people every night for `days` days. Everything
+// runs off RandomEngine::set_seed(seed) so two runs of the same commit do the
+// same work and the numbers can be compared commit to commit.
+//
+// Prints per system tick time, path requests per second and heap
+// allocations (those only in the `make benchai` build), then returns the
+// process exit code.
+
+namespace ai_benchmark {
+
+struct Config {
+    std::string seed = "bench";
+    int customers = 20;
+    int days = 1;
+};
+
+int run(const Config& config);
+
+}  // namespace ai_benchmark
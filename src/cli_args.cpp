@@ -1,6 +1,7 @@
 
 #include "cli_args.h"
 
+#include <algorithm>
 #include <set>
 #include <string>
 
@@ -40,6 +41,9 @@ std::string LOAD_SAVE_TARGET = "";
 bool LOAD_SAVE_ENABLED = false;
 bool MAP_VIEWER = false;
 std::string MAP_VIEWER_SEED = "";
+bool BENCH_AI = false;
+int BENCH_AI_CUSTOMERS = 20;
+int BENCH_AI_DAYS = 1;
 
 #ifdef AFTER_HOURS_ENABLE_MCP
 bool MCP_ENABLED = false;
@@ -72,10 +76,12 @@ void process_dev_flags(int argc, char* argv[]) {
             "--test_map_generation",
             "--replay-validate",
             "--map-viewer",
+            "--bench-ai",
             "--mcp"};
         static const std::set<std::string> with_value = {
-            "--replay",    "--bypass-rounds", "--generate-map",
-            "--load-save", "--seed",
+            "--replay",     "--bypass-rounds", "--generate-map",
+            "--load-save",  "--seed",          "--bench-customers",
+            "--bench-days",
         };
 
         // Accept --flag=value form for value flags.
@@ -98,7 +104,8 @@ void process_dev_flags(int argc, char* argv[]) {
             // If this flag expects a value, skip the next token.
             if ((arg == "--replay" || arg == "--bypass-rounds" ||
                  arg == "--generate-map" || arg == "--load-save" ||
-                 arg == "--seed") &&
+                 arg == "--seed" || arg == "--bench-customers" ||
+                 arg == "--bench-days") &&
                 i + 1 < argc) {
                 ++i;
             }
@@ -273,6 +280,22 @@ void process_dev_flags(int argc, char* argv[]) {
         log_info("--map-viewer flag detected");
     }
 
+    // Headless, seeded with --seed like the map viewer
+    if (cmdl[{"--bench-ai"}]) {
+        BENCH_AI = true;
+        ENABLE_MODELS = false;
+        ENABLE_SOUND = false;
+        network::ENABLE_REMOTE_IP = false;
+    }
+    if (cmdl({"--bench-customers"})) {
+        cmdl({"--bench-customers"}) >> BENCH_AI_CUSTOMERS;
+        BENCH_AI_CUSTOMERS = std::max(1, BENCH_AI_CUSTOMERS);
+    }
+    if (cmdl({"--bench-days"})) {
+        cmdl({"--bench-days"}) >> BENCH_AI_DAYS;
+        BENCH_AI_DAYS = std::max(1, BENCH_AI_DAYS);
+    }
+
 #ifdef AFTER_HOURS_ENABLE_MCP
     if (cmdl[{"--mcp"}]) {
         MCP_ENABLED = true;
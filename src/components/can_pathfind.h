@@ -1,8 +1,7 @@
 
 #pragma once
 
-#include <deque>
-
+#include "../engine/compact_path.h"
 #include "../engine/path_request_manager.h"
 #include "../entities/entity_helper.h"
 #include "../entities/entity_id.h"
@@ -25,8 +24,7 @@ struct CanPathfind : public BaseComponent {
             return false;
         }
 
-        Transform& transform = parent_entity.get<Transform>();
-        vec2 me = transform.as2();
+        vec2 me = parent_entity.get<Transform>().as2();
 
         global_target = end;
 
@@ -35,32 +33,53 @@ struct CanPathfind : public BaseComponent {
             return false;
         }
         ensure_active_local_target();
-        move_transform_toward_local_target(speed);
-
-        if (local_target.has_value())
-            transform.turn_to_face_pos(local_target.value());
+        if (!local_target.has_value()) {
+            log_warn("Tried to ensure local target but still dont have one");
+            return is_at_position(end);
+        }
 
+        // The step itself (and turning to face the target) is taken by
+        // AIMovementSystem for everyone at once, so this checks arrival
+        // against where we were at the start of the tick
+        pending_speed += speed;
         return is_at_position(end);
     }
 
-    [[nodiscard]] std::deque<vec2> get_path() const { return path; }
+    // AIMovementSystem only, hands over the step queued by travel_toward
+    [[nodiscard]] bool take_pending_move(vec2& target, float& speed) {
+        stepped = pending_speed != 0.f && local_target.has_value();
+        if (!stepped) return false;
+        target = local_target.value();
+        speed = pending_speed;
+        pending_speed = 0.f;
+        return true;
+    }
+
+    // Whether AIMovementSystem moved us this tick
+    [[nodiscard]] bool took_step() const { return stepped; }
+
+    // Waypoints still ahead, only valid until the path changes
+    [[nodiscard]] PathView get_path() const { return path.view(); }
 
     void for_each_path_location(const std::function<void(vec2)>& cb) const {
         if (is_path_empty()) return;
-        for (auto location : path) {
-            cb(location);
-        }
+        path.for_each_step(cb);
     }
 
     [[nodiscard]] size_t get_max_length() const { return max_path_length; }
 
-    void update_path(const std::deque<vec2>& new_path) {
-        path = new_path;
-        path_size = (int) path.size();
+    // Close enough to count as arrived, same test travel_toward uses
+    [[nodiscard]] bool is_at(vec2 position) const {
+        return is_at_position(position);
+    }
+
+    void update_path(CompactPath&& new_path) {
+        path = std::move(new_path);
+        path_size = (int) path.steps();
 
         has_active_request = false;
-        max_path_length = std::max(max_path_length, path.size());
-        log_trace("{} recieved a path of length {}", parent.id, path.size());
+        max_path_length = std::max(max_path_length, path.steps());
+        log_trace("{} recieved a path of length {}", parent.id, path.steps());
     }
 
     auto& set_parent(EntityID id) {
@@ -69,35 +88,12 @@ struct CanPathfind : public BaseComponent {
     }
 
    private:
-    [[nodiscard]] bool is_at_position(vec2 position) {
+    [[nodiscard]] bool is_at_position(vec2 position) const {
         const Entity& owner = parent.resolve_enforced();
         return vec::distance(owner.get<Transform>().as2(), position) <
                (TILESIZE / 2.f);
     }
 
-    void move_transform_toward_local_target(float speed) {
-        Entity& owner = parent.resolve_enforced();
-        if (!local_target.has_value()) {
-            log_warn("Tried to ensure local target but still dont have one");
-            return;
-        }
-
-        Transform& transform = owner.get<Transform>();
-        vec2 new_pos = transform.as2();
-        vec2 tar = local_target.value();
-        if (tar.x > transform.raw().x) new_pos.x += speed;
-        if (tar.x < transform.raw().x) new_pos.x -= speed;
-
-        if (tar.y > transform.raw().z) new_pos.y += speed;
-        if (tar.y < transform.raw().z) new_pos.y -= speed;
-
-        // TODO do we need to unr the whole person_update...() function with
-        // collision?
-        // // TODO what does "unr" mean ?
-
-        transform.update(vec::to3(new_pos));
-    }
-
     void path_to(vec2 begin, vec2 end) {
         if (has_active_request) {
             // just keep waiting
@@ -111,10 +107,11 @@ struct CanPathfind : public BaseComponent {
         start = begin;
         goal = end;
 
+        // Set first, a cached path gets handed back before this returns
+        has_active_request = true;
         PathRequestManager::enqueue_request(PathRequestManager::PathRequest{
             .entity_id = parent.id, .start = start, .end = goal});
 
-        has_active_request = true;
         log_trace("{} requested path from {} to {} ", parent.id, start, goal);
     }
 
@@ -124,7 +121,7 @@ struct CanPathfind : public BaseComponent {
             if (!is_at_position(local_target.value())) return;
         }
 
-        local_target = path[0];
+        local_target = path.front();
         path.pop_front();
     }
 
@@ -132,11 +129,14 @@ struct CanPathfind : public BaseComponent {
     std::optional<vec2> global_target;
 
     bool has_active_request = false;
+    // Speed travel_toward asked for this tick, not applied yet
+    float pending_speed = 0.f;
+    bool stepped = false;
     vec2 start;
     vec2 goal;
 
     int path_size = 0;
-    std::deque<vec2> path;
+    CompactPath path;
     size_t max_path_length = 0;
 
     EntityRef parent{};
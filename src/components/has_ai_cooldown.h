@@ -2,10 +2,17 @@
 
 #include "base_component.h"
 #include "cooldown_info.h"
+#include "is_ai_controlled.h"
+#include "sim_lod_info.h"
 
 struct HasAICooldown : public BaseComponent {
     CooldownInfo cooldown{};
 
+    // How often the current state's logic runs, see ai_lod_step. Server
+    // side only so neither is serialized
+    SimLODInfo lod{};
+    IsAIControlled::State lod_state = IsAIControlled::State::Wander;
+
    private:
    public:
     friend zpp::bits::access;
@@ -2,6 +2,7 @@
 
 //
 #include "base_component.h"
+#include "sim_lod_info.h"
 
 struct HasPatience : public BaseComponent {
     HasPatience() {
@@ -9,20 +10,35 @@ struct HasPatience : public BaseComponent {
         update_max(20.f);
     }
 
-    [[nodiscard]] float pct() const { return amount_left_s / max_patience_s; }
+    // Counts time ReduceImpatientCustomersSystem has not applied yet
+    [[nodiscard]] float amount_left() const {
+        return amount_left_s - lod.pending();
+    }
+    [[nodiscard]] float pct() const { return amount_left() / max_patience_s; }
 
-    void reset() { amount_left_s = max_patience_s; }
+    void reset() {
+        amount_left_s = max_patience_s;
+        lod.reset();
+    }
     void update_max(float mx) {
         max_patience_s = mx;
-        amount_left_s = max_patience_s;
+        reset();
     }
     void pass_time(float dt) { amount_left_s -= dt; }
 
     void enable() { should_subtract = true; }
-    void disable() { should_subtract = false; }
+    void disable() {
+        // Whatever went by before this still counts
+        amount_left_s = amount_left();
+        lod.reset();
+        should_subtract = false;
+    }
 
     [[nodiscard]] bool should_pass_time() const { return should_subtract; }
 
+    // Server side only, not serialized
+    SimLODInfo lod{};
+
    private:
     bool should_subtract;
     float amount_left_s;
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <optional>
+
+// Simulation level of detail for one piece of per tick logic.
+//
+// At full rate the logic runs every tick like anything else. At reduced rate
+// it only runs every REDUCED_INTERVAL ticks and is handed all the time that
+// went by since it last ran, so timers fed from it still add up to the same
+// total, they just move in bigger steps.
+//
+// Whoever owns the logic decides when it is safe to reduce (nothing moving,
+// only waiting on a timer or on someone else) and promotes it back the
+// moment something happens that needs an answer on the same tick.
+//
+// Server side scheduling only, never serialized.
+struct SimLODInfo {
+    // 120 tick server, a parked customer thinks 30 times a second
+    static constexpr int REDUCED_INTERVAL = 4;
+
+    [[nodiscard]] bool is_reduced() const { return reduced; }
+    // Time that went by but has not been handed out yet
+    [[nodiscard]] float pending() const { return pending_dt; }
+
+    // How much time to simulate this tick, nothing when this tick is skipped
+    [[nodiscard]] std::optional<float> step(float dt) {
+        pending_dt += dt;
+        if (reduced && ++ticks_waited < REDUCED_INTERVAL) return {};
+        ticks_waited = 0;
+        float out = pending_dt;
+        pending_dt = 0.f;
+        return out;
+    }
+
+    // `phase` spreads everyone over the interval so a full bar does not all
+    // land on the same tick, the entity id is good enough
+    void reduce(int phase) {
+        if (reduced) return;
+        reduced = true;
+        ticks_waited = phase % REDUCED_INTERVAL;
+    }
+
+    // Back to every tick, whatever piled up goes out with the next step
+    void promote() {
+        reduced = false;
+        ticks_waited = 0;
+    }
+
+    // Back to every tick and forget the time that piled up
+    void reset() {
+        promote();
+        pending_dt = 0.f;
+    }
+
+   private:
+    bool reduced = false;
+    int ticks_waited = 0;
+    float pending_dt = 0.f;
+};
@@ -17,17 +17,35 @@ struct Transform : public BaseComponent {
         LEFT = 0x8
     };
 
-    const std::map<FrontFaceDirection, float> FrontFaceDirectionMap{
-        {FORWARD, 0.0f},        {FORWARD | RIGHT, 45.0f}, {RIGHT, 90.0f},
-        {BACK | RIGHT, 135.0f}, {BACK, 180.0f},           {BACK | LEFT, 225.0f},
-        {LEFT, 270.0f},         {FORWARD | LEFT, 315.0f}};
+    // Every 45 degrees starting at 0 (FORWARD), going clockwise.
+    // These used to be std::maps on every Transform, which meant two heap
+    // allocated trees per entity just to look up eight values.
+    static constexpr std::array<FrontFaceDirection, 8> FACE_DIRECTIONS{
+        FORWARD,
+        static_cast<FrontFaceDirection>(FORWARD | RIGHT),
+        RIGHT,
+        static_cast<FrontFaceDirection>(BACK | RIGHT),
+        BACK,
+        static_cast<FrontFaceDirection>(BACK | LEFT),
+        LEFT,
+        static_cast<FrontFaceDirection>(FORWARD | LEFT),
+    };
+
+    [[nodiscard]] static constexpr int direction_to_degrees(
+        FrontFaceDirection direction) {
+        for (size_t i = 0; i < FACE_DIRECTIONS.size(); i++) {
+            if (FACE_DIRECTIONS[i] == direction) return (int) i * 45;
+        }
+        return 0;
+    }
 
-    const std::map<int, FrontFaceDirection> DirectionToFrontFaceMap{
-        {0, FORWARD},        {45, FORWARD | RIGHT}, {90, RIGHT},
-        {135, BACK | RIGHT}, {180, BACK},           {225, BACK | LEFT},
-        {270, LEFT},         {315, FORWARD | LEFT}};
+    // degrees must already be rounded to a multiple of 45
+    [[nodiscard]] static constexpr FrontFaceDirection degrees_to_direction(
+        int degrees) {
+        return FACE_DIRECTIONS[(size_t) ((degrees / 45) % 8)];
+    }
 
-    int roundToNearest45(int degrees) const {
+    static constexpr int roundToNearest45(int degrees) {
         int remainder = degrees % 45;
         int roundedValue = degrees - remainder;
 
@@ -49,10 +67,9 @@ struct Transform : public BaseComponent {
     FrontFaceDirection offsetFaceDirection(FrontFaceDirection startingDirection,
                                            int offset) const {
         const auto degreesOffset = roundToNearest45(
-            (static_cast<int>(FrontFaceDirectionMap.at(startingDirection)) +
-             offset));
+            direction_to_degrees(startingDirection) + offset);
 
-        return DirectionToFrontFaceMap.at(degreesOffset % 360);
+        return degrees_to_direction(degreesOffset % 360);
     }
 
     auto& init(vec3 pos, vec3 sz) {
@@ -248,9 +265,9 @@ struct Transform : public BaseComponent {
         });
     }
 
-    [[nodiscard]] const FrontFaceDirection& face_direction() const {
+    [[nodiscard]] FrontFaceDirection face_direction() const {
         const auto r = roundToNearest45(static_cast<int>(facing));
-        return DirectionToFrontFaceMap.at(r);
+        return degrees_to_direction(r);
     }
 
     // This exists so that its easy to make sure the real location
@@ -355,6 +372,10 @@ struct Transform : public BaseComponent {
     }
 };
 
+static_assert(Transform::direction_to_degrees(Transform::RIGHT) == 90);
+static_assert(Transform::degrees_to_direction(225) ==
+              (Transform::BACK | Transform::LEFT));
+
 inline std::ostream& operator<<(std::ostream& os, const Transform& t) {
     os << "Transform<> " << t.pos() << " " << t.size();
     return os;
@@ -12,6 +12,7 @@
 #include "rlgl.h"
 #include "strings.h"
 //
+#include "text_mesh_cache.h"
 #include "text_util.h"
 #include "vec_util.h"
 
@@ -226,7 +227,7 @@ static void DrawFloatingText(const vec3& position, const Font& font,
         .color = color,
     };
 
-    DrawText3D(titleConfig);
+    TextMeshCache::get().draw(titleConfig);
 
     rlPopMatrix();
 }
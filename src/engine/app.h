@@ -39,6 +39,10 @@ struct App {
         return mainRT.texture;
     }
 
+    // Layers draw inside the main texture, anything that renders into its
+    // own texture mid frame has to switch back with this afterwards
+    void resume_main_texture_mode() { raylib::BeginTextureMode(mainRT); }
+
    private:
     bool running = false;
     int width;
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <vector>
+
+#include "../external_include.h"
+
+// Read only look at the waypoints of a path that are still ahead
+struct PathView {
+    const vec2* first = nullptr;
+    size_t count = 0;
+
+    [[nodiscard]] const vec2* begin() const { return first; }
+    [[nodiscard]] const vec2* end() const { return first + count; }
+    [[nodiscard]] size_t size() const { return count; }
+    [[nodiscard]] bool empty() const { return count == 0; }
+    [[nodiscard]] const vec2& operator[](size_t i) const { return first[i]; }
+    [[nodiscard]] const vec2& front() const { return first[0]; }
+    [[nodiscard]] const vec2& back() const { return first[count - 1]; }
+};
+
+// A finished path, kept as the corners of its straight runs.
+//
+// The searches hand back one point per tile. Customers step x and y toward
+// their waypoint separately (see CanPathfind), so heading straight for the
+// far end of a straight or diagonal run crosses the same tiles as stopping
+// on every one of them, and only the corners are kept.
+//
+// The points sit in one vector and are consumed from the front by moving a
+// cursor, instead of a deque per customer being popped.
+//
+// Move only so a path goes from the path thread to the component without
+// being copied, use clone() where a real copy is wanted.
+struct CompactPath {
+    CompactPath() = default;
+    CompactPath(CompactPath&&) noexcept = default;
+    CompactPath& operator=(CompactPath&&) noexcept = default;
+    CompactPath(const CompactPath&) = delete;
+    CompactPath& operator=(const CompactPath&) = delete;
+
+    [[nodiscard]] static CompactPath from_steps(const std::deque<vec2>& steps) {
+        CompactPath out;
+        out.num_steps = steps.size();
+        for (size_t i = 0; i < steps.size(); i++) {
+            bool interior = i > 0 && i + 1 < steps.size();
+            if (interior && same_step(steps[i - 1], steps[i], steps[i + 1]))
+                continue;
+            out.points.push_back(steps[i]);
+        }
+        return out;
+    }
+
+    [[nodiscard]] CompactPath clone() const {
+        CompactPath out;
+        out.points.assign(points.begin() + (std::ptrdiff_t) cursor,
+                          points.end());
+        out.num_steps = num_steps;
+        return out;
+    }
+
+    [[nodiscard]] bool empty() const { return cursor >= points.size(); }
+    // Waypoints left
+    [[nodiscard]] size_t size() const { return points.size() - cursor; }
+    // Tiles the whole path crossed when it was found
+    [[nodiscard]] size_t steps() const { return num_steps; }
+
+    [[nodiscard]] const vec2& front() const { return points[cursor]; }
+    [[nodiscard]] vec2& back() { return points.back(); }
+    [[nodiscard]] const vec2& back() const { return points.back(); }
+    void pop_front() { cursor++; }
+
+    [[nodiscard]] PathView view() const {
+        return PathView{points.data() + cursor, size()};
+    }
+
+    // Every tile still ahead, with the runs filled back in
+    template<typename Fn>
+    void for_each_step(Fn&& fn) const {
+        for (size_t i = cursor; i < points.size(); i++) {
+            if (i > cursor) fill_run(points[i - 1], points[i], fn);
+            fn(points[i]);
+        }
+    }
+
+   private:
+    [[nodiscard]] static bool same_step(vec2 a, vec2 b, vec2 c) {
+        return b.x - a.x == c.x - b.x && b.y - a.y == c.y - b.y;
+    }
+
+    // The tiles strictly between two corners, only when they really are a
+    // straight or diagonal run of whole tiles
+    template<typename Fn>
+    static void fill_run(vec2 from, vec2 to, Fn& fn) {
+        float dx = to.x - from.x;
+        float dy = to.y - from.y;
+        float n = std::max(std::abs(dx), std::abs(dy));
+        if (n < 2.f || n != std::floor(n)) return;
+        if (dx != 0.f && std::abs(dx) != n) return;
+        if (dy != 0.f && std::abs(dy) != n) return;
+        for (int k = 1; k < (int) n; k++) {
+            fn(vec2{from.x + dx / n * (float) k, from.y + dy / n * (float) k});
+        }
+    }
+
+    std::vector<vec2> points;
+    size_t cursor = 0;
+    size_t num_steps = 0;
+};
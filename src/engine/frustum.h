@@ -3,6 +3,8 @@
 // From Raylib Extras https://github.com/JeffM2501/raylibExtras
 // see copyright at the bottom
 
+#include <cstring>
+
 #include "../external_include.h"
 
 struct Frustum {
@@ -28,10 +30,20 @@ struct Frustum {
     }
     ~Frustum() {}
 
-    void fetch_data() {
+    // Returns true when the camera matrices changed since the last fetch so
+    // callers can keep visibility results while the view is unchanged
+    [[nodiscard]] bool fetch_data() {
         raylib::Matrix proj = raylib::rlGetMatrixProjection();
         raylib::Matrix mv = raylib::rlGetMatrixModelview();
 
+        if (has_data && matrix_equal(proj, last_proj) &&
+            matrix_equal(mv, last_mv)) {
+            return false;
+        }
+        has_data = true;
+        last_proj = proj;
+        last_mv = mv;
+
         raylib::Matrix planes = {0};
 
         planes.m0 = mv.m0 * proj.m0 + mv.m1 * proj.m4 + mv.m2 * proj.m8 +
@@ -96,6 +108,7 @@ struct Frustum {
             planes.m3 + planes.m2, planes.m7 + planes.m6,
             planes.m11 + planes.m10, planes.m15 + planes.m14};
         normalize_plane(Planes[FrustumPlanes::Front]);
+        return true;
     }
 
     [[nodiscard]] bool point_inside(float x, float y, float z) const {
@@ -170,6 +183,15 @@ struct Frustum {
     }
 
    private:
+    bool has_data = false;
+    raylib::Matrix last_proj = {0};
+    raylib::Matrix last_mv = {0};
+
+    [[nodiscard]] static bool matrix_equal(const raylib::Matrix& a,
+                                           const raylib::Matrix& b) {
+        return std::memcmp(&a, &b, sizeof(raylib::Matrix)) == 0;
+    }
+
     void normalize_plane(vec4& plane) {
         float magnitude =
             sqrtf(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
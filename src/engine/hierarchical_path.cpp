@@ -0,0 +1,382 @@
+#include "hierarchical_path.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <queue>
+#include <utility>
+
+#include "bfs.h"
+
+namespace {
+constexpr int neigh_x[8] = {-1, -1, -1, 0, 0, 1, 1, 1};
+constexpr int neigh_y[8] = {-1, 0, 1, -1, 1, -1, 0, 1};
+
+constexpr int UNVISITED = -1;
+
+// Every step costs the same in the bfs, diagonal or not
+[[nodiscard]] int step_distance(HierarchicalPathfinder::Tile a,
+                                HierarchicalPathfinder::Tile b) {
+    return std::max(std::abs(a.x - b.x), std::abs(a.y - b.y));
+}
+// Straight (diagonal first) steps from the back of `route` to `to`
+void append_line(std::vector<HierarchicalPathfinder::Tile>& route,
+                 HierarchicalPathfinder::Tile to) {
+    HierarchicalPathfinder::Tile cur = route.back();
+    while (!(cur == to)) {
+        cur.x += (to.x > cur.x) - (to.x < cur.x);
+        cur.y += (to.y > cur.y) - (to.y < cur.y);
+        route.push_back(cur);
+    }
+}
+}  // namespace
+
+std::deque<vec2> HierarchicalPathfinder::find_path(const ObstacleGrid& g,
+                                                   vec2 start, vec2 end) {
+    const auto is_walkable = [&g](const vec2& pos) {
+        return g.is_walkable(pos);
+    };
+    if (vec::distance(start, end) <= SHORT_PATH) {
+        return bfs::find_path(start, end, is_walkable);
+    }
+
+    grid = &g;
+    if (!built || built_generation != g.generation) rebuild(g);
+    // No obstacles at all
+    if (area_width == 0) return bfs::find_path(start, end, is_walkable);
+
+    Tile s{ObstacleGrid::to_tile(start.x), ObstacleGrid::to_tile(start.y)};
+    Tile e{ObstacleGrid::to_tile(end.x), ObstacleGrid::to_tile(end.y)};
+    // Everything past the margin is open floor, so endpoints out there just
+    // walk straight in to the edge of the area
+    Tile s_in = clamp_to_area(s);
+    Tile e_in = clamp_to_area(e);
+
+    exempt_a = s_in;
+    exempt_b = e_in;
+    has_exempt = true;
+
+    std::vector<Tile> tiles;
+    bool found = search_graph(s_in, e_in, tiles);
+    if (!found) {
+        // Portals only join clusters straight across their border, so a
+        // route that only squeezes through diagonally at a corner needs the
+        // full search
+        search_from(s_in, area);
+        if (reached(e_in)) {
+            extract(e_in, tiles);
+            found = true;
+        }
+    }
+    has_exempt = false;
+    if (!found) return {};
+
+    std::vector<Tile> route{s};
+    append_line(route, s_in);
+    route.insert(route.end(), tiles.begin() + 1, tiles.end());
+    append_line(route, e);
+
+    // Same shape as the bfs gives: the tile we are on is left off and it
+    // ends exactly on `end`
+    std::deque<vec2> path;
+    for (size_t i = 1; i + 1 < route.size(); i++) {
+        path.push_back(vec2{(float) route[i].x * TILESIZE,
+                            (float) route[i].y * TILESIZE});
+    }
+    path.push_back(end);
+    return path;
+}
+
+void HierarchicalPathfinder::rebuild(const ObstacleGrid& g) {
+    grid = &g;
+    built = true;
+    built_generation = g.generation;
+    nodes.clear();
+    segments.clear();
+    cluster_nodes.clear();
+    touched.clear();
+
+    if (g.width == 0 || g.height == 0) {
+        area = Bounds{0, 0, -1, -1};
+        area_width = 0;
+        clusters_w = 0;
+        clusters_h = 0;
+        parent.clear();
+        return;
+    }
+
+    area = Bounds{g.min_x - MARGIN, g.min_y - MARGIN,
+                  g.min_x + g.width - 1 + MARGIN,
+                  g.min_y + g.height - 1 + MARGIN};
+    area_width = area.max_x - area.min_x + 1;
+    int area_height = area.max_y - area.min_y + 1;
+    clusters_w = (area_width + CLUSTER_SIZE - 1) / CLUSTER_SIZE;
+    clusters_h = (area_height + CLUSTER_SIZE - 1) / CLUSTER_SIZE;
+    cluster_nodes.assign((size_t) (clusters_w * clusters_h), {});
+    parent.assign((size_t) area_width * (size_t) area_height, UNVISITED);
+
+    // One portal in the middle of every open stretch of shared border
+    const auto scan_border = [&](Tile first, int step_x, int step_y,
+                                 int cross_x, int cross_y, int length) {
+        int run_start = -1;
+        for (int i = 0; i <= length; i++) {
+            bool open = false;
+            if (i < length) {
+                Tile a{first.x + step_x * i, first.y + step_y * i};
+                Tile b{a.x + cross_x, a.y + cross_y};
+                open = walkable(a) && walkable(b);
+            }
+            if (open && run_start < 0) run_start = i;
+            if (open || run_start < 0) continue;
+
+            int mid = (run_start + i - 1) / 2;
+            Tile a{first.x + step_x * mid, first.y + step_y * mid};
+            add_portal(a, Tile{a.x + cross_x, a.y + cross_y});
+            run_start = -1;
+        }
+    };
+
+    for (int cy = 0; cy < clusters_h; cy++) {
+        for (int cx = 0; cx < clusters_w; cx++) {
+            Bounds b = cluster_bounds(cy * clusters_w + cx);
+            if (cx + 1 < clusters_w) {
+                scan_border(Tile{b.max_x, b.min_y}, 0, 1, 1, 0,
+                            b.max_y - b.min_y + 1);
+            }
+            if (cy + 1 < clusters_h) {
+                scan_border(Tile{b.min_x, b.max_y}, 1, 0, 0, 1,
+                            b.max_x - b.min_x + 1);
+            }
+        }
+    }
+
+    // Cache the route between every pair of portals inside each cluster
+    std::vector<Tile> seg;
+    for (size_t c = 0; c < cluster_nodes.size(); c++) {
+        const std::vector<int>& ids = cluster_nodes[c];
+        Bounds b = cluster_bounds((int) c);
+        for (size_t i = 0; i < ids.size(); i++) {
+            search_from(nodes[ids[i]].tile, b);
+            for (size_t j = i + 1; j < ids.size(); j++) {
+                if (!reached(nodes[ids[j]].tile)) continue;
+                extract(nodes[ids[j]].tile, seg);
+                int cost = (int) seg.size() - 1;
+                int index = (int) segments.size();
+                segments.push_back(seg);
+                nodes[ids[i]].edges.push_back(Edge{ids[j], cost, index, false});
+                nodes[ids[j]].edges.push_back(Edge{ids[i], cost, index, true});
+            }
+        }
+    }
+}
+
+void HierarchicalPathfinder::add_portal(Tile a, Tile b) {
+    int na = add_node(a);
+    int nb = add_node(b);
+    nodes[na].edges.push_back(Edge{nb, 1, -1, false});
+    nodes[nb].edges.push_back(Edge{na, 1, -1, false});
+}
+
+int HierarchicalPathfinder::add_node(Tile tile) {
+    int id = (int) nodes.size();
+    int cluster = cluster_of(tile);
+    nodes.push_back(Node{tile, cluster, {}});
+    cluster_nodes[cluster].push_back(id);
+    return id;
+}
+
+HierarchicalPathfinder::Bounds HierarchicalPathfinder::cluster_bounds(
+    int cluster) const {
+    int cx = cluster % clusters_w;
+    int cy = cluster / clusters_w;
+    Bounds b;
+    b.min_x = area.min_x + cx * CLUSTER_SIZE;
+    b.min_y = area.min_y + cy * CLUSTER_SIZE;
+    b.max_x = std::min(area.max_x, b.min_x + CLUSTER_SIZE - 1);
+    b.max_y = std::min(area.max_y, b.min_y + CLUSTER_SIZE - 1);
+    return b;
+}
+
+HierarchicalPathfinder::Tile HierarchicalPathfinder::clamp_to_area(
+    Tile t) const {
+    return Tile{std::clamp(t.x, area.min_x, area.max_x),
+                std::clamp(t.y, area.min_y, area.max_y)};
+}
+
+bool HierarchicalPathfinder::walkable(Tile t) const {
+    if (has_exempt && (t == exempt_a || t == exempt_b)) return true;
+    return grid->is_tile_walkable(t.x, t.y);
+}
+
+void HierarchicalPathfinder::search_from(Tile root, const Bounds& bounds) {
+    for (size_t i : touched) parent[i] = UNVISITED;
+    touched.clear();
+    queue.clear();
+
+    size_t r = area_index(root);
+    parent[r] = (int) r;
+    touched.push_back(r);
+    queue.push_back(r);
+
+    for (size_t head = 0; head < queue.size(); head++) {
+        size_t cur = queue[head];
+        Tile t{area.min_x + (int) (cur % (size_t) area_width),
+               area.min_y + (int) (cur / (size_t) area_width)};
+        for (int a = 0; a < 8; a++) {
+            Tile n{t.x + neigh_x[a], t.y + neigh_y[a]};
+            if (n.x < bounds.min_x || n.y < bounds.min_y ||
+                n.x > bounds.max_x || n.y > bounds.max_y)
+                continue;
+            size_t ni = area_index(n);
+            if (parent[ni] != UNVISITED) continue;
+            if (!walkable(n)) continue;
+            parent[ni] = (int) cur;
+            touched.push_back(ni);
+            queue.push_back(ni);
+        }
+    }
+}
+
+bool HierarchicalPathfinder::reached(Tile t) const {
+    return in_area(t) && parent[area_index(t)] != UNVISITED;
+}
+
+void HierarchicalPathfinder::extract(Tile t, std::vector<Tile>& out) const {
+    out.clear();
+    size_t idx = area_index(t);
+    while (true) {
+        out.push_back(Tile{area.min_x + (int) (idx % (size_t) area_width),
+                           area.min_y + (int) (idx / (size_t) area_width)});
+        if (parent[idx] == (int) idx) break;
+        idx = (size_t) parent[idx];
+    }
+    std::reverse(out.begin(), out.end());
+}
+
+bool HierarchicalPathfinder::search_graph(Tile s, Tile e,
+                                          std::vector<Tile>& tiles) {
+    const int num_nodes = (int) nodes.size();
+    const int START = num_nodes;
+    const int GOAL = num_nodes + 1;
+    const int cs = cluster_of(s);
+    const int ce = cluster_of(e);
+
+    using Link = std::pair<int, std::vector<Tile>>;
+    std::vector<Link> start_links;
+    std::vector<Link> goal_links;
+    std::vector<int> goal_link_of(num_nodes, -1);
+    std::vector<Tile> direct;
+
+    search_from(s, cluster_bounds(cs));
+    for (int n : cluster_nodes[cs]) {
+        if (!reached(nodes[n].tile)) continue;
+        Link& link = start_links.emplace_back(n, std::vector<Tile>{});
+        extract(nodes[n].tile, link.second);
+    }
+    const bool has_direct = cs == ce && reached(e);
+    if (has_direct) extract(e, direct);
+
+    search_from(e, cluster_bounds(ce));
+    for (int n : cluster_nodes[ce]) {
+        if (!reached(nodes[n].tile)) continue;
+        goal_link_of[n] = (int) goal_links.size();
+        Link& link = goal_links.emplace_back(n, std::vector<Tile>{});
+        extract(nodes[n].tile, link.second);
+        std::reverse(link.second.begin(), link.second.end());
+    }
+
+    enum struct Kind { Edge, StartLink, GoalLink, Direct };
+    struct Via {
+        int prev = -1;
+        Kind kind = Kind::Edge;
+        int index = 0;
+    };
+
+    const auto tile_of = [&](int n) {
+        if (n == START) return s;
+        if (n == GOAL) return e;
+        return nodes[n].tile;
+    };
+
+    std::vector<int> cost((size_t) num_nodes + 2, INT_MAX);
+    std::vector<Via> via((size_t) num_nodes + 2);
+    using Item = std::pair<int, int>;
+    std::priority_queue<Item, std::vector<Item>, std::greater<Item>> open;
+
+    const auto relax = [&](int to, int c, Via how) {
+        if (c >= cost[to]) return;
+        cost[to] = c;
+        via[to] = how;
+        open.push(Item{c + step_distance(tile_of(to), e), to});
+    };
+
+    cost[START] = 0;
+    open.push(Item{step_distance(s, e), START});
+    while (!open.empty()) {
+        auto [f, n] = open.top();
+        open.pop();
+        if (n == GOAL) break;
+        if (f > cost[n] + step_distance(tile_of(n), e)) continue;
+
+        if (n == START) {
+            for (size_t i = 0; i < start_links.size(); i++) {
+                const Link& link = start_links[i];
+                relax(link.first, (int) link.second.size() - 1,
+                      Via{START, Kind::StartLink, (int) i});
+            }
+            if (has_direct) {
+                relax(GOAL, (int) direct.size() - 1,
+                      Via{START, Kind::Direct, 0});
+            }
+            continue;
+        }
+
+        const std::vector<Edge>& edges = nodes[n].edges;
+        for (size_t i = 0; i < edges.size(); i++) {
+            relax(edges[i].to, cost[n] + edges[i].cost,
+                  Via{n, Kind::Edge, (int) i});
+        }
+        int gl = goal_link_of[n];
+        if (gl >= 0) {
+            relax(GOAL, cost[n] + (int) goal_links[gl].second.size() - 1,
+                  Via{n, Kind::GoalLink, gl});
+        }
+    }
+    if (cost[GOAL] == INT_MAX) return false;
+
+    std::vector<Via> chain;
+    for (int n = GOAL; n != START; n = via[n].prev) chain.push_back(via[n]);
+    std::reverse(chain.begin(), chain.end());
+
+    tiles.clear();
+    const auto append = [&](const std::vector<Tile>& seg, bool reversed) {
+        for (size_t i = 0; i < seg.size(); i++) {
+            const Tile& t = reversed ? seg[seg.size() - 1 - i] : seg[i];
+            if (!tiles.empty() && tiles.back() == t) continue;
+            tiles.push_back(t);
+        }
+    };
+
+    for (const Via& v : chain) {
+        switch (v.kind) {
+            case Kind::StartLink:
+                append(start_links[v.index].second, false);
+                break;
+            case Kind::GoalLink:
+                append(goal_links[v.index].second, false);
+                break;
+            case Kind::Direct:
+                append(direct, false);
+                break;
+            case Kind::Edge: {
+                const Edge& edge = nodes[v.prev].edges[v.index];
+                if (edge.segment < 0) {
+                    append({nodes[v.prev].tile, nodes[edge.to].tile}, false);
+                } else {
+                    append(segments[edge.segment], edge.reversed);
+                }
+            } break;
+        }
+    }
+    return true;
+}
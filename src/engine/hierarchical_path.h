@@ -0,0 +1,117 @@
+#pragma once
+
+#include <deque>
+#include <vector>
+
+#include "../external_include.h"
+#include "obstacle_grid.h"
+
+// Two level path search for the path thread, for paths the plain bfs cant
+// find (it gives up 50 tiles out).
+//
+// The area around the obstacle grid is cut into CLUSTER_SIZE square clusters.
+// Rooms and buildings are not tracked at runtime, so fixed clusters stand in
+// for them. Wherever two neighboring clusters share an open stretch of border
+// there is a portal, and the tile path between every pair of portals inside a
+// cluster is worked out once per obstacle grid and cached.
+//
+// A long request is then two local searches to hook the start and goal up to
+// their cluster's portals, a small A* over the portals, and the cached
+// segments stitched together. Short requests still go straight to the bfs.
+//
+// Path thread only.
+struct HierarchicalPathfinder {
+    static constexpr int CLUSTER_SIZE = 10;
+    // Open floor around the obstacles that paths are allowed to use
+    static constexpr int MARGIN = 2;
+    // Closer than this the bfs is cheaper than going through the graph
+    static constexpr float SHORT_PATH = 20.f;
+
+    struct Tile {
+        int x = 0;
+        int y = 0;
+        bool operator==(const Tile&) const = default;
+    };
+
+    [[nodiscard]] std::deque<vec2> find_path(const ObstacleGrid& grid,
+                                             vec2 start, vec2 end);
+
+    [[nodiscard]] size_t num_portals() const { return nodes.size(); }
+
+   private:
+    struct Edge {
+        int to = 0;
+        int cost = 0;
+        // Index into segments, -1 for the single step between two clusters
+        int segment = -1;
+        bool reversed = false;
+    };
+
+    struct Node {
+        Tile tile;
+        int cluster = 0;
+        std::vector<Edge> edges;
+    };
+
+    struct Bounds {
+        int min_x = 0;
+        int min_y = 0;
+        int max_x = 0;
+        int max_y = 0;
+    };
+
+    void rebuild(const ObstacleGrid& grid);
+    void add_portal(Tile a, Tile b);
+    int add_node(Tile tile);
+
+    [[nodiscard]] bool in_area(Tile t) const {
+        return t.x >= area.min_x && t.y >= area.min_y && t.x <= area.max_x &&
+               t.y <= area.max_y;
+    }
+    [[nodiscard]] size_t area_index(Tile t) const {
+        return (size_t) (t.y - area.min_y) * (size_t) area_width +
+               (size_t) (t.x - area.min_x);
+    }
+    [[nodiscard]] int cluster_of(Tile t) const {
+        return ((t.y - area.min_y) / CLUSTER_SIZE) * clusters_w +
+               (t.x - area.min_x) / CLUSTER_SIZE;
+    }
+    [[nodiscard]] Bounds cluster_bounds(int cluster) const;
+    [[nodiscard]] Tile clamp_to_area(Tile t) const;
+    [[nodiscard]] bool walkable(Tile t) const;
+
+    // Breadth first flood from `root` inside `bounds`, then extract() the
+    // tile path root -> t for anything it reached
+    void search_from(Tile root, const Bounds& bounds);
+    [[nodiscard]] bool reached(Tile t) const;
+    void extract(Tile t, std::vector<Tile>& out) const;
+
+    // A* over the portals with the start and goal hooked in, fills `tiles`
+    // with the stitched route start -> goal
+    [[nodiscard]] bool search_graph(Tile start, Tile goal,
+                                    std::vector<Tile>& tiles);
+
+    const ObstacleGrid* grid = nullptr;
+    size_t built_generation = 0;
+    bool built = false;
+
+    Bounds area;
+    int area_width = 0;
+    int clusters_w = 0;
+    int clusters_h = 0;
+
+    std::vector<Node> nodes;
+    std::vector<std::vector<int>> cluster_nodes;
+    std::vector<std::vector<Tile>> segments;
+
+    // Endpoints of the current request, walkable even if something stands
+    // on them (same as the bfs which never checks either end)
+    Tile exempt_a;
+    Tile exempt_b;
+    bool has_exempt = false;
+
+    // search_from scratch, reused between searches
+    std::vector<int> parent;
+    std::vector<size_t> touched;
+    std::vector<size_t> queue;
+};
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "thread_role.h"
+
+// Small fixed set of worker threads for splitting up a tick.
+//
+// run() hands out every job, helps out on the calling thread and blocks until
+// they are all done, so callers never have to think about lifetimes. Workers
+// take on the caller's thread_role for the batch, which means entity lookups
+// from a job hit the same collection the caller would.
+//
+// Only one thread should call run() at a time (the server thread).
+struct JobPool {
+    explicit JobPool(size_t num_workers) {
+        for (size_t i = 0; i < num_workers; i++) {
+            workers.emplace_back([this]() { worker_loop(); });
+        }
+    }
+
+    ~JobPool() {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stopping = true;
+        }
+        work_cv.notify_all();
+        for (std::thread& t : workers) t.join();
+    }
+
+    JobPool(const JobPool&) = delete;
+    JobPool& operator=(const JobPool&) = delete;
+
+    // Threads that can be working on a batch at once, including the caller
+    [[nodiscard]] size_t concurrency() const { return workers.size() + 1; }
+
+    void run(std::vector<std::function<void()>>& batch) {
+        if (batch.empty()) return;
+        if (batch.size() == 1 || workers.empty()) {
+            for (auto& job : batch) job();
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(mtx);
+        jobs = &batch;
+        next = 0;
+        remaining = batch.size();
+        role = thread_role::current;
+        lock.unlock();
+        work_cv.notify_all();
+
+        lock.lock();
+        while (next < jobs->size()) {
+            size_t i = next++;
+            lock.unlock();
+            (*jobs)[i]();
+            lock.lock();
+            remaining--;
+        }
+        done_cv.wait(lock, [&]() { return remaining == 0; });
+        jobs = nullptr;
+    }
+
+    static size_t default_worker_count() {
+        // Leave room for the main thread and the path thread
+        size_t hw = std::thread::hardware_concurrency();
+        return std::clamp<size_t>(hw > 3 ? hw - 3 : 0, 0, 4);
+    }
+
+   private:
+    void worker_loop() {
+        std::unique_lock<std::mutex> lock(mtx);
+        while (true) {
+            work_cv.wait(lock, [&]() {
+                return stopping || (jobs && next < jobs->size());
+            });
+            if (stopping) return;
+
+            size_t i = next++;
+            thread_role::set(role);
+            lock.unlock();
+            (*jobs)[i]();
+            lock.lock();
+            if (--remaining == 0) done_cv.notify_all();
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::mutex mtx;
+    std::condition_variable work_cv;
+    std::condition_variable done_cv;
+
+    std::vector<std::function<void()>>* jobs = nullptr;
+    size_t next = 0;
+    size_t remaining = 0;
+    thread_role::Role role = thread_role::Role::ClientMain;
+    bool stopping = false;
+};
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+#include "../external_include.h"
+#include "../vec_util.h"
+
+// Tile bitmap of everything the path thread has to walk around.
+//
+// A tile is blocked when some obstacle is within half a tile of its center,
+// which is the same test the old obstacle scan did for every probe, just
+// answered up front so each lookup is an index instead of a loop over all
+// obstacles.
+struct ObstacleGrid {
+    // Bumped every time a new grid gets published,
+    // anything cached against walkability can compare against this
+    size_t generation = 0;
+
+    int min_x = 0;
+    int min_y = 0;
+    int width = 0;
+    int height = 0;
+    std::vector<unsigned char> blocked;
+    // What the grid was built from, used for probes that are not on a tile
+    // center and by the publisher to tell if anything changed
+    std::vector<vec2> obstacles;
+
+    static constexpr float BLOCK_DIST_SQ = 0.25f;
+
+    void rebuild(const std::vector<vec2>& positions, size_t gen) {
+        generation = gen;
+        obstacles = positions;
+        blocked.clear();
+        width = 0;
+        height = 0;
+        if (obstacles.empty()) return;
+
+        int max_x = 0;
+        int max_y = 0;
+        min_x = max_x = to_tile(obstacles[0].x);
+        min_y = max_y = to_tile(obstacles[0].y);
+        for (const vec2& p : obstacles) {
+            min_x = std::min(min_x, to_tile(p.x) - 1);
+            min_y = std::min(min_y, to_tile(p.y) - 1);
+            max_x = std::max(max_x, to_tile(p.x) + 1);
+            max_y = std::max(max_y, to_tile(p.y) + 1);
+        }
+        width = max_x - min_x + 1;
+        height = max_y - min_y + 1;
+        blocked.assign((size_t) width * (size_t) height, 0);
+
+        for (const vec2& p : obstacles) {
+            // The tile we rounded to is the only candidate unless the
+            // obstacle sits exactly between two tiles
+            int tx = to_tile(p.x);
+            int ty = to_tile(p.y);
+            for (int x = tx - 1; x <= tx + 1; x++) {
+                for (int y = ty - 1; y <= ty + 1; y++) {
+                    vec2 center{(float) x * TILESIZE, (float) y * TILESIZE};
+                    if (vec::distance_sq(p, center) > BLOCK_DIST_SQ) continue;
+                    blocked[index(x, y)] = 1;
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] bool is_walkable(const vec2& pos) const {
+        int tx = to_tile(pos.x);
+        int ty = to_tile(pos.y);
+        bool on_tile_center = (float) tx * TILESIZE == pos.x &&
+                              (float) ty * TILESIZE == pos.y;
+        if (!on_tile_center) {
+            for (const vec2& e : obstacles) {
+                if (vec::distance_sq(e, pos) <= BLOCK_DIST_SQ) return false;
+            }
+            return true;
+        }
+
+        return is_tile_walkable(tx, ty);
+    }
+
+    [[nodiscard]] bool contains_tile(int tx, int ty) const {
+        return tx >= min_x && ty >= min_y && tx < min_x + width &&
+               ty < min_y + height;
+    }
+
+    // Nothing is near tiles outside the grid so those are always open
+    [[nodiscard]] bool is_tile_walkable(int tx, int ty) const {
+        if (!contains_tile(tx, ty)) return true;
+        return blocked[index(tx, ty)] == 0;
+    }
+
+    static int to_tile(float v) { return (int) std::round(v / TILESIZE); }
+
+    // Only valid for tiles inside the grid
+    [[nodiscard]] size_t index(int x, int y) const {
+        return (size_t) (y - min_y) * (size_t) width + (size_t) (x - min_x);
+    }
+};
+
+// Two grids, one being read by the path thread and one the game thread can
+// rebuild into. Publishing is a single atomic flip so the reader never
+// blocks and never sees a half built grid.
+//
+// Single writer (game thread) and single reader (path thread):
+// - the reader marks which buffer it is using, then double checks that
+//   buffer is still the front, otherwise it retries
+// - the writer only rebuilds the back buffer when the reader is not on it,
+//   otherwise it leaves the change pending and tries again next tick
+struct DoubleBufferedObstacleGrid {
+    struct ReadLock {
+        DoubleBufferedObstacleGrid* owner = nullptr;
+        const ObstacleGrid* grid = nullptr;
+
+        ReadLock(DoubleBufferedObstacleGrid& o) : owner(&o) {
+            while (true) {
+                int idx = owner->front.load();
+                owner->reader_using.store(idx);
+                if (owner->front.load() == idx) {
+                    grid = &owner->buffers[idx];
+                    break;
+                }
+            }
+        }
+        ~ReadLock() { owner->reader_using.store(-1); }
+
+        ReadLock(const ReadLock&) = delete;
+        ReadLock& operator=(const ReadLock&) = delete;
+
+        const ObstacleGrid& operator*() const { return *grid; }
+        const ObstacleGrid* operator->() const { return grid; }
+    };
+
+    // Game thread only. Returns true if a new grid was published
+    bool publish_if_changed(const std::vector<vec2>& positions) {
+        int back = 1 - front.load();
+        const ObstacleGrid& current = buffers[1 - back];
+        if (!pending && current.obstacles == positions) return false;
+
+        // path thread is still finishing a search on the old grid
+        if (reader_using.load() == back) {
+            pending = true;
+            return false;
+        }
+
+        buffers[back].rebuild(positions, current.generation + 1);
+        front.store(back);
+        pending = false;
+        return true;
+    }
+
+    // Game thread only
+    [[nodiscard]] size_t generation() const {
+        return buffers[front.load()].generation;
+    }
+
+   private:
+    std::array<ObstacleGrid, 2> buffers;
+    std::atomic<int> front{0};
+    std::atomic<int> reader_using{-1};
+    bool pending = false;
+};
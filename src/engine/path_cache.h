@@ -0,0 +1,127 @@
+#pragma once
+
+#include <atomic>
+#include <list>
+#include <optional>
+#include <unordered_map>
+
+#include "../external_include.h"
+#include "compact_path.h"
+#include "obstacle_grid.h"
+
+// Read by the debug overlay while the server thread writes them
+struct PathCacheStats {
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> evictions{0};
+    std::atomic<size_t> size{0};
+
+    [[nodiscard]] float hit_rate() const {
+        uint64_t h = hits.load(std::memory_order_relaxed);
+        uint64_t total = h + misses.load(std::memory_order_relaxed);
+        return total ? (float) h / (float) total : 0.f;
+    }
+};
+
+// Finished paths, keyed on the start and goal tiles plus the obstacle grid
+// generation they were searched on.
+//
+// Customers ask for the same few routes over and over (door to register,
+// register to toilet, anywhere to the exit), and while nothing is being
+// moved around the answer cannot change. Failed searches are kept too, those
+// are the most expensive ones to redo.
+//
+// Least recently used entries get dropped once it is full, and everything
+// goes the moment the generation moves on.
+//
+// Game thread only (besides the stats).
+struct PathCache {
+    static constexpr size_t CAPACITY = 256;
+
+    [[nodiscard]] std::optional<CompactPath> find(vec2 start, vec2 end,
+                                                  size_t generation) {
+        flush_if_stale(generation);
+        auto it = index.find(key_for(start, end));
+        if (it == index.end()) {
+            stats.misses.fetch_add(1, std::memory_order_relaxed);
+            return {};
+        }
+        stats.hits.fetch_add(1, std::memory_order_relaxed);
+
+        entries.splice(entries.begin(), entries, it->second);
+        CompactPath path = it->second->path.clone();
+        // Same tile but not quite the same spot, finish where this one asked
+        if (!path.empty()) path.back() = end;
+        return path;
+    }
+
+    void insert(vec2 start, vec2 end, size_t generation,
+                const CompactPath& path) {
+        // Searched on a grid that has already been replaced
+        if (generation < current_generation) return;
+        flush_if_stale(generation);
+
+        Key key = key_for(start, end);
+        auto it = index.find(key);
+        if (it != index.end()) {
+            it->second->path = path.clone();
+            entries.splice(entries.begin(), entries, it->second);
+            return;
+        }
+
+        if (entries.size() >= CAPACITY) {
+            index.erase(entries.back().key);
+            entries.pop_back();
+            stats.evictions.fetch_add(1, std::memory_order_relaxed);
+        }
+        entries.push_front(Entry{key, path.clone()});
+        index[key] = entries.begin();
+        stats.size.store(entries.size(), std::memory_order_relaxed);
+    }
+
+    static PathCacheStats& get_stats() { return stats; }
+
+   private:
+    struct Key {
+        int start_x;
+        int start_y;
+        int end_x;
+        int end_y;
+        bool operator==(const Key&) const = default;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& k) const {
+            size_t h = std::hash<int>()(k.start_x);
+            for (int v : {k.start_y, k.end_x, k.end_y}) {
+                h ^= std::hash<int>()(v) + 0x9e3779b9 + (h << 6) + (h >> 2);
+            }
+            return h;
+        }
+    };
+
+    struct Entry {
+        Key key;
+        CompactPath path;
+    };
+
+    [[nodiscard]] static Key key_for(vec2 start, vec2 end) {
+        return Key{ObstacleGrid::to_tile(start.x),
+                   ObstacleGrid::to_tile(start.y), ObstacleGrid::to_tile(end.x),
+                   ObstacleGrid::to_tile(end.y)};
+    }
+
+    void flush_if_stale(size_t generation) {
+        if (generation <= current_generation) return;
+        current_generation = generation;
+        entries.clear();
+        index.clear();
+        stats.size.store(0, std::memory_order_relaxed);
+    }
+
+    size_t current_generation = 0;
+    std::list<Entry> entries;
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+
+    inline static PathCacheStats stats;
+};
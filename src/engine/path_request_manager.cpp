@@ -5,7 +5,8 @@
 #include "../entities/entity.h"
 #include "../system/input/input_process_manager.h"
 #include "../system/input/is_collidable.h"
-#include "bfs.h"
+#include "hierarchical_path.h"
+#include "walkable_regions.h"
 
 static std::shared_ptr<PathRequestManager> g_path_request_manager;
 
@@ -13,11 +14,8 @@ void PathRequestManager::process_responses(
     const std::vector<std::shared_ptr<Entity>>& entities) {
     //
     {
-        std::lock_guard<std::mutex> lock(
-            g_path_request_manager->entities_mutex_);
-
-        g_path_request_manager->entities_storage_.clear();
-        g_path_request_manager->entities_storage_.reserve(entities.size());
+        std::vector<vec2>& obstacles = g_path_request_manager->obstacle_scratch;
+        obstacles.clear();
 
         for (const std::shared_ptr<Entity>& entity : entities) {
             // Remove non collidables
@@ -25,20 +23,31 @@ void PathRequestManager::process_responses(
                 continue;
 
             // only store the positions
-            g_path_request_manager->entities_storage_.push_back(
-                entity->get<Transform>().as2());
+            obstacles.push_back(entity->get<Transform>().as2());
         }
+
+        // Only rebuilds + flips when something actually moved
+        g_path_request_manager->obstacle_grid.publish_if_changed(obstacles);
+        // Same for the reachability labels the game thread queries
+        walkable_regions::get().update_if_changed(obstacles);
     }
 
     PathResponse response;
     while (g_path_request_manager->response_queue.try_pop_front(response)) {
-        OptEntity requester = EntityHelper::getEntityForID(response.entity_id);
-        if (requester.has_value()) {
-            requester->get<CanPathfind>().update_path(response.path);
-            if (response.onComplete) response.onComplete(response.path);
-        } else {
-            log_warn("Path requester {} no longer exists", response.entity_id);
-        }
+        g_path_request_manager->path_cache.insert(
+            response.start, response.end, response.generation, response.path);
+        deliver(response);
+    }
+}
+
+void PathRequestManager::deliver(PathResponse& response) {
+    OptEntity requester = EntityHelper::getEntityForID(response.entity_id);
+    if (requester.has_value()) {
+        CanPathfind& cpf = requester->get<CanPathfind>();
+        cpf.update_path(std::move(response.path));
+        if (response.onComplete) response.onComplete(cpf.get_path());
+    } else {
+        log_warn("Path requester {} no longer exists", response.entity_id);
     }
 }
 
@@ -49,6 +58,23 @@ void PathRequestManager::enqueue_request(const PathRequest& request) {
             "manager thread",
             request.entity_id);
     }
+
+    std::optional<CompactPath> cached =
+        g_path_request_manager->path_cache.find(
+            request.start, request.end,
+            g_path_request_manager->obstacle_grid.generation());
+    if (cached.has_value()) {
+        PathResponse response{
+            .entity_id = request.entity_id,
+            .start = request.start,
+            .end = request.end,
+            .path = std::move(cached.value()),
+            .onComplete = request.onComplete,
+        };
+        deliver(response);
+        return;
+    }
+
     g_path_request_manager->request_queue.push_back(request);
 }
 
@@ -59,25 +85,32 @@ std::thread PathRequestManager::start() {
         std::bind(&PathRequestManager::run, g_path_request_manager.get()));
 }
 
+void PathRequestManager::start_inline() {
+    g_path_request_manager.reset(new PathRequestManager());
+}
+
+size_t PathRequestManager::process_requests_inline() {
+    if (!g_path_request_manager) return 0;
+    return g_path_request_manager->process_requests();
+}
+
 void PathRequestManager::stop() {
     if (!g_path_request_manager) return;
     g_path_request_manager->running.store(false, std::memory_order_release);
 }
 
-bool PathRequestManager::is_walkable(const vec2& pos) {
-    bool hit_impassable = false;
-    std::lock_guard<std::mutex> lock(g_path_request_manager->entities_mutex_);
-    for (const auto& e : entities_storage_) {
-        // ignore things that are not at this location
-        if (vec::distance_sq(e, pos) > 0.25f) continue;
-        hit_impassable = true;
-        break;
-    }
-    return !hit_impassable;
-}
-
-std::deque<vec2> PathRequestManager::find_path(const PathRequest& request) {
-    return bfs::find_path(request.start, request.end, [&](const vec2& pos) {
-        return this->is_walkable(pos);
-    });
+PathRequestManager::PathResponse PathRequestManager::find_path(
+    PathRequest& request) {
+    // Hold on to one grid for the whole search so every probe sees the same
+    // obstacles
+    DoubleBufferedObstacleGrid::ReadLock grid(obstacle_grid);
+    return PathResponse{
+        .entity_id = request.entity_id,
+        .start = request.start,
+        .end = request.end,
+        .generation = grid->generation,
+        .path = CompactPath::from_steps(
+            hierarchical.find_path(*grid, request.start, request.end)),
+        .onComplete = std::move(request.onComplete),
+    };
 }
@@ -8,10 +8,15 @@
 
 #include "../entities/entity.h"
 #include "atomic_queue.h"
+#include "compact_path.h"
+#include "hierarchical_path.h"
+#include "obstacle_grid.h"
+#include "path_cache.h"
 #include "singleton.h"
+#include "tick_scheduler.h"
 
 struct PathRequestManager {
-    using OnCompleteFn = std::function<void(const std::deque<vec2>&)>;
+    using OnCompleteFn = std::function<void(PathView)>;
 
     struct PathRequest {
         int entity_id;
@@ -22,14 +27,24 @@ struct PathRequestManager {
 
     struct PathResponse {
         int entity_id;
-        std::deque<vec2> path;
+        vec2 start;
+        vec2 end;
+        // Obstacle grid the search ran on
+        size_t generation = 0;
+        CompactPath path;
         OnCompleteFn onComplete;
     };
 
-    std::vector<vec2> entities_storage_;
-    std::mutex entities_mutex_;
+    // Written by the game thread, read lock free by the path thread
+    DoubleBufferedObstacleGrid obstacle_grid;
+    // Game thread scratch, reused so collecting obstacles doesnt allocate
+    std::vector<vec2> obstacle_scratch;
+    // Game thread, requests that hit are answered without a search
+    PathCache path_cache;
     AtomicQueue<PathRequest> request_queue;
 
+    // Answered on the spot when the path cache has it, otherwise queued for
+    // the path thread
     static void enqueue_request(const PathRequest& request);
 
     static void process_responses(
@@ -42,48 +57,37 @@ struct PathRequestManager {
 
     AtomicQueue<PathResponse> response_queue;
     std::atomic<bool> running{false};
+    // Portal graph, rebuilt whenever the obstacle grid generation changes
+    HierarchicalPathfinder hierarchical;
 
-    bool is_walkable(const vec2& pos);
-    std::deque<vec2> find_path(const PathRequest& request);
+    PathResponse find_path(PathRequest& request);
+    static void deliver(PathResponse& response);
 
     static std::thread start();
+    // No path thread, requests wait until process_requests_inline() is called
+    // (benchmarks, where answers have to land on the same tick every run)
+    static void start_inline();
+    static size_t process_requests_inline();
+
+    // Answers everything queued so far, returns how many
+    size_t process_requests() {
+        size_t processed = 0;
+        PathRequest request;
+        while (request_queue.try_pop_front(request)) {
+            response_queue.push_back(find_path(request));
+            processed++;
+        }
+        return processed;
+    }
 
     void run() {
         // should probably always be about / above whats in the game.h
         constexpr float desiredFrameRate = 240.0f;
-        constexpr std::chrono::duration<float> fixedTimeStep(1.0f /
-                                                             desiredFrameRate);
-
-        auto previousTime = std::chrono::high_resolution_clock::now();
-        auto currentTime = previousTime;
-        while (running.load(std::memory_order_acquire)) {
-            currentTime = std::chrono::high_resolution_clock::now();
-            float duration =
-                std::chrono::duration_cast<std::chrono::duration<float>>(
-                    currentTime - previousTime)
-                    .count();
-            size_t ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-                            currentTime - previousTime)
-                            .count();
-
-            if (ms < 3) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
-            }
-
-            if (duration <= fixedTimeStep.count()) {
-                continue;
-            }
-            previousTime = currentTime;
-
-            PathRequest request;
-            while (request_queue.try_pop_front(request)) {
-                auto path = find_path(request);
-                response_queue.push_back(PathResponse{
-                    .entity_id = request.entity_id,
-                    .path = std::move(path),
-                    .onComplete = std::move(request.onComplete),
-                });
-            }
-        }
+        // Draining the queue twice back to back does nothing the first drain
+        // didnt, so never catch up
+        TickScheduler scheduler("path", desiredFrameRate, 1);
+
+        scheduler.run_while(running,
+                            [this](float) { (void) process_requests(); });
     }
 };
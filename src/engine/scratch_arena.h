@@ -0,0 +1,107 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <set>
+#include <vector>
+
+// Per thread bump allocator for lists that only live for part of a tick
+// (query candidates, targets to skip, generated paths before they get
+// copied into a component, ...).
+//
+// Everything handed out is dropped at once by reset(), which the server calls
+// at the start of every tick. Allocations come out of a single buffer and
+// anything that does not fit falls through to the heap and is counted, then
+// on the next reset the buffer grows to cover it. After a few ticks of warmup
+// scratch lists stop showing up in `make alloc` entirely.
+//
+// Nothing allocated from here can outlive the tick, so never keep one of
+// these in a component or a static.
+namespace scratch {
+
+struct Arena : public std::pmr::memory_resource {
+    // Enough for the common case so the first ticks do not all overflow
+    static constexpr size_t INITIAL_BYTES = 64 * 1024;
+
+    Arena() : buffer(INITIAL_BYTES) {}
+
+    void reset() {
+        if (overflow_bytes > 0) {
+            buffer = std::vector<std::byte>(
+                std::max(buffer.size() * 2, offset + overflow_bytes));
+        }
+        last_used = offset;
+        last_overflow_allocs = overflow_allocs;
+        offset = 0;
+        overflow_bytes = 0;
+        overflow_allocs = 0;
+    }
+
+    [[nodiscard]] size_t capacity() const { return buffer.size(); }
+    // Bytes handed out from the buffer during the last full tick
+    [[nodiscard]] size_t used_last_tick() const { return last_used; }
+    // Allocations that had to go to the heap during the last full tick
+    [[nodiscard]] size_t overflowed_last_tick() const {
+        return last_overflow_allocs;
+    }
+
+   private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        void* ptr = buffer.data() + offset;
+        size_t space = buffer.size() - offset;
+        if (std::align(alignment, bytes, ptr, space)) {
+            offset = buffer.size() - space + bytes;
+            return ptr;
+        }
+        overflow_bytes += bytes + alignment;
+        overflow_allocs++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override {
+        const std::byte* p = static_cast<const std::byte*>(ptr);
+        if (p >= buffer.data() && p < buffer.data() + buffer.size()) {
+            // Bump allocator, freed in bulk on reset()
+            return;
+        }
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(
+        const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    std::vector<std::byte> buffer;
+    size_t offset = 0;
+    size_t overflow_bytes = 0;
+    size_t overflow_allocs = 0;
+
+    size_t last_used = 0;
+    size_t last_overflow_allocs = 0;
+};
+
+inline Arena& arena() {
+    thread_local Arena instance;
+    return instance;
+}
+
+template<typename T>
+using Vector = std::pmr::vector<T>;
+
+template<typename T>
+using Set = std::pmr::set<T>;
+
+template<typename T>
+[[nodiscard]] Vector<T> vector() {
+    return Vector<T>(&arena());
+}
+
+template<typename T>
+[[nodiscard]] Set<T> set() {
+    return Set<T>(&arena());
+}
+
+}  // namespace scratch
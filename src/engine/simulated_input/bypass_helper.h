@@ -1,7 +1,9 @@
 #pragma once
 
 #include "../../components/bypass_automation_state.h"
+#include "../../components/has_day_night_timer.h"
 #include "../../entities/entity_helper.h"
+#include "../../entities/singleton_component.h"
 #include "../../external_include.h"
 #include "../../globals.h"
 #include "../../network/network.h"
@@ -20,16 +22,15 @@ inline void inject_clicks_for_bypass(float dt) {
 
 #if ENABLE_DEV_FLAGS
     BypassAutomationState* state = nullptr;
-    try {
-        Entity& sophie = EntityHelper::getNamedEntity(NamedEntity::Sophie);
-        state = &sophie.addComponentIfMissing<BypassAutomationState>();
+    OptEntity sophie = Singleton<HasDayNightTimer>::entity();
+    if (sophie) {
+        state = &sophie.asE().addComponentIfMissing<BypassAutomationState>();
         active = state->bypass_enabled && !state->completed;
         if (state->completed) {
             BYPASS_MENU = false;
         } else if (state->bypass_enabled) {
             BYPASS_MENU = true;
         }
-    } catch (...) {
     }
 #else
     BypassAutomationState* state = nullptr;
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "log.h"
+
+// Per thread tick numbers, readable from any thread (debug overlay).
+struct TickStats {
+    std::string name;
+    float hz = 0.f;
+
+    std::atomic<uint64_t> ticks{0};
+    // Ticks whose work took longer than one step
+    std::atomic<uint64_t> overruns{0};
+    // Steps thrown away because we were too far behind to catch up
+    std::atomic<uint64_t> dropped{0};
+    // Fraction of wall time spent inside the tick over the last window
+    std::atomic<float> utilization{0.f};
+    std::atomic<float> avg_tick_ms{0.f};
+
+    explicit TickStats(std::string n, float h) : name(std::move(n)), hz(h) {}
+
+    // Stats live forever so the overlay never sees a dangling one, even after
+    // the server restarts.
+    static TickStats& get(std::string_view name, float hz) {
+        std::lock_guard<std::mutex> lock(registry_mutex());
+        for (TickStats& s : registry()) {
+            if (s.name == name) {
+                s.hz = hz;
+                return s;
+            }
+        }
+        return registry().emplace_back(std::string(name), hz);
+    }
+
+    template<typename Fn>
+    static void for_each(Fn&& fn) {
+        std::lock_guard<std::mutex> lock(registry_mutex());
+        for (const TickStats& s : registry()) fn(s);
+    }
+
+   private:
+    static std::deque<TickStats>& registry() {
+        static std::deque<TickStats> stats;
+        return stats;
+    }
+    static std::mutex& registry_mutex() {
+        static std::mutex mtx;
+        return mtx;
+    }
+};
+
+// Fixed timestep loop for the server and path threads.
+//
+// Sleeps until the next deadline instead of polling the clock, and when a
+// tick runs long it runs up to `max_catch_up` steps back to back to get on
+// schedule again. Anything past that is dropped (counted) and the schedule
+// restarts from now, so one hitch doesnt turn into a burst of fast ticks.
+struct TickScheduler {
+    using Clock = std::chrono::steady_clock;
+
+    TickScheduler(std::string_view name, float hz, int max_catch_up_ = 4)
+        : step(std::chrono::duration_cast<Clock::duration>(
+              std::chrono::duration<float>(1.f / hz))),
+          dt(1.f / hz),
+          max_catch_up(std::max(1, max_catch_up_)),
+          stats(TickStats::get(name, hz)) {}
+
+    // Runs `tick(dt)` at the fixed rate until `running` goes false. Stopping
+    // takes at most one step.
+    template<typename Fn>
+    void run_while(const std::atomic<bool>& running, Fn&& tick) {
+        Clock::time_point next = Clock::now() + step;
+        window_start = Clock::now();
+
+        while (running.load(std::memory_order_acquire)) {
+            Clock::time_point now = Clock::now();
+            if (now < next) {
+                std::this_thread::sleep_until(next);
+                continue;
+            }
+
+            int steps = 0;
+            while (now >= next && steps < max_catch_up) {
+                Clock::time_point start = Clock::now();
+                tick(dt);
+                Clock::duration took = Clock::now() - start;
+
+                record(took);
+                next += step;
+                steps++;
+                now = Clock::now();
+            }
+
+            if (now >= next) {
+                uint64_t behind = (uint64_t) ((now - next) / step) + 1;
+                stats.dropped.fetch_add(behind, std::memory_order_relaxed);
+                next = now + step;
+            }
+
+            maybe_report(now);
+        }
+    }
+
+   private:
+    void record(Clock::duration took) {
+        busy += took;
+        window_ticks++;
+        stats.ticks.fetch_add(1, std::memory_order_relaxed);
+        if (took > step) {
+            stats.overruns.fetch_add(1, std::memory_order_relaxed);
+            window_overruns++;
+        }
+    }
+
+    void maybe_report(Clock::time_point now) {
+        Clock::duration elapsed = now - window_start;
+        if (elapsed < std::chrono::seconds(1)) return;
+
+        float busy_ms =
+            std::chrono::duration<float, std::milli>(busy).count();
+        float wall_ms =
+            std::chrono::duration<float, std::milli>(elapsed).count();
+        stats.utilization.store(busy_ms / wall_ms, std::memory_order_relaxed);
+        stats.avg_tick_ms.store(window_ticks ? busy_ms / window_ticks : 0.f,
+                                std::memory_order_relaxed);
+
+        if (window_overruns > 0) {
+            log_warn("{}: {} of {} ticks overran {:.2f}ms, utilization {:.0f}%",
+                     stats.name, window_overruns, window_ticks,
+                     dt * 1000.f, 100.f * busy_ms / wall_ms);
+        }
+
+        window_start = now;
+        busy = Clock::duration::zero();
+        window_ticks = 0;
+        window_overruns = 0;
+    }
+
+    Clock::duration step;
+    float dt;
+    int max_catch_up;
+    TickStats& stats;
+
+    Clock::time_point window_start;
+    Clock::duration busy = Clock::duration::zero();
+    uint64_t window_ticks = 0;
+    uint64_t window_overruns = 0;
+};
@@ -3,6 +3,7 @@
 
 #include <vector>
 
+#include "../app.h"
 #include "../graphics.h"
 
 struct IUIContextRenderTextures {
@@ -39,3 +40,64 @@ struct IUIContextRenderTextures {
         render_textures.clear();
     }
 };
+
+// A screen sized render texture that keeps what was drawn into it between
+// frames, for things like the minimap and static panels that change rarely
+// but are expensive to redraw.
+//
+// The caller hashes everything the contents depend on into a signature, we
+// only redraw when that changes (or the window was resized / mark_dirty was
+// called) and otherwise just blit the last result.
+//
+//  if (cache.begin_if_stale(signature)) {
+//      draw_contents();
+//      cache.end();
+//  }
+//  cache.draw();
+struct RetainedRenderTexture {
+    raylib::RenderTexture2D target{};
+    size_t signature = 0;
+    bool valid = false;
+    size_t num_redraws = 0;
+
+    void mark_dirty() { valid = false; }
+
+    // Returns true and starts drawing into the texture when the contents are
+    // stale, the caller must call end() once done
+    [[nodiscard]] bool begin_if_stale(size_t new_signature) {
+        if (target.id == 0 || target.texture.width != WIN_W() ||
+            target.texture.height != WIN_H()) {
+            unload();
+            target = raylib::LoadRenderTexture(WIN_W(), WIN_H());
+        }
+
+        if (valid && signature == new_signature) return false;
+        signature = new_signature;
+        valid = true;
+        num_redraws++;
+
+        raylib::BeginTextureMode(target);
+        raylib::ClearBackground(raylib::BLANK);
+        return true;
+    }
+
+    void end() {
+        raylib::EndTextureMode();
+        App::get().resume_main_texture_mode();
+    }
+
+    void draw() const {
+        if (target.id == 0) return;
+        // render textures are stored upside down
+        DrawTextureRec(target.texture,
+                       Rectangle{0, 0, (float) target.texture.width,
+                                 (float) -target.texture.height},
+                       vec2{0, 0}, WHITE);
+    }
+
+    void unload() {
+        if (target.id != 0) raylib::UnloadRenderTexture(target);
+        target = raylib::RenderTexture2D{};
+        valid = false;
+    }
+};
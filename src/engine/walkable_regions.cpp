@@ -0,0 +1,132 @@
+#include "walkable_regions.h"
+
+#include <array>
+#include <cmath>
+
+#include "../entities/entity_helper.h"
+#include "is_server.h"
+#include "pathfinder.h"
+
+namespace {
+constexpr int neigh_x[8] = {-1, -1, -1, 0, 0, 1, 1, 1};
+constexpr int neigh_y[8] = {-1, 0, 1, -1, 1, -1, 0, 1};
+
+// How close the bfs has to get to the start before it calls it found
+constexpr float ARRIVE_DIST_SQ = 4.f;
+}  // namespace
+
+bool WalkableRegions::update_if_changed(const std::vector<vec2>& obstacles) {
+    if (built() && grid.obstacles == obstacles) return false;
+    generation++;
+    grid.rebuild(obstacles, generation);
+    relabel();
+    return true;
+}
+
+void WalkableRegions::relabel() {
+    constexpr int UNLABELED = -1;
+    labels.assign(grid.blocked.size(), UNLABELED);
+    for (size_t i = 0; i < labels.size(); i++) {
+        if (grid.blocked[i]) labels[i] = BLOCKED;
+    }
+    num_regions = 1;
+
+    std::vector<size_t> queue;
+    const auto flood = [&](int label) {
+        while (!queue.empty()) {
+            size_t i = queue.back();
+            queue.pop_back();
+            int x = grid.min_x + (int) (i % (size_t) grid.width);
+            int y = grid.min_y + (int) (i / (size_t) grid.width);
+            for (int a = 0; a < 8; a++) {
+                int nx = x + neigh_x[a];
+                int ny = y + neigh_y[a];
+                if (!grid.contains_tile(nx, ny)) continue;
+                size_t n = grid.index(nx, ny);
+                if (labels[n] != UNLABELED) continue;
+                labels[n] = label;
+                queue.push_back(n);
+            }
+        }
+    };
+
+    // Open tiles on the edge of the grid touch the open floor around it
+    const auto seed_outside = [&](int x, int y) {
+        size_t i = grid.index(x, y);
+        if (labels[i] != UNLABELED) return;
+        labels[i] = OUTSIDE;
+        queue.push_back(i);
+    };
+    for (int x = grid.min_x; x < grid.min_x + grid.width; x++) {
+        seed_outside(x, grid.min_y);
+        seed_outside(x, grid.min_y + grid.height - 1);
+    }
+    for (int y = grid.min_y; y < grid.min_y + grid.height; y++) {
+        seed_outside(grid.min_x, y);
+        seed_outside(grid.min_x + grid.width - 1, y);
+    }
+    flood(OUTSIDE);
+
+    for (size_t i = 0; i < labels.size(); i++) {
+        if (labels[i] != UNLABELED) continue;
+        int label = ++num_regions;
+        labels[i] = label;
+        queue.push_back(i);
+        flood(label);
+    }
+}
+
+int WalkableRegions::label_at_tile(int tx, int ty) const {
+    if (!grid.contains_tile(tx, ty)) return OUTSIDE;
+    return labels[grid.index(tx, ty)];
+}
+
+bool WalkableRegions::can_reach(vec2 start, vec2 goal) const {
+    if (vec::distance_sq(start, goal) < ARRIVE_DIST_SQ) return true;
+
+    // bfs::find_path searches out from the goal, whose first step is to the
+    // tiles around its truncated position
+    std::array<int, 8> goal_labels{};
+    int num_goal_labels = 0;
+    int gx = static_cast<int>(goal.x);
+    int gy = static_cast<int>(goal.y);
+    for (int a = 0; a < 8; a++) {
+        int label = label_at_tile(gx + neigh_x[a], gy + neigh_y[a]);
+        if (label == BLOCKED) continue;
+        goal_labels[num_goal_labels++] = label;
+    }
+    if (num_goal_labels == 0) return false;
+
+    // and stops on any open tile close enough to the start
+    int sx = ObstacleGrid::to_tile(start.x);
+    int sy = ObstacleGrid::to_tile(start.y);
+    for (int x = sx - 2; x <= sx + 2; x++) {
+        for (int y = sy - 2; y <= sy + 2; y++) {
+            vec2 center{(float) x * TILESIZE, (float) y * TILESIZE};
+            if (vec::distance_sq(center, start) >= ARRIVE_DIST_SQ) continue;
+            int label = label_at_tile(x, y);
+            if (label == BLOCKED) continue;
+            for (int i = 0; i < num_goal_labels; i++) {
+                if (goal_labels[i] == label) return true;
+            }
+        }
+    }
+    return false;
+}
+
+namespace walkable_regions {
+
+WalkableRegions& get() {
+    static WalkableRegions regions;
+    return regions;
+}
+
+bool can_reach(vec2 start, vec2 goal) {
+    if (is_server() && get().built()) return get().can_reach(start, goal);
+    return !pathfinder::find_path(
+                start, goal,
+                std::bind(EntityHelper::isWalkable, std::placeholders::_1))
+                .empty();
+}
+
+}  // namespace walkable_regions
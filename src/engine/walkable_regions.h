@@ -0,0 +1,56 @@
+#pragma once
+
+#include <vector>
+
+#include "../external_include.h"
+#include "obstacle_grid.h"
+
+// Connected regions of walkable tiles (8 way, same moves the bfs makes).
+//
+// Two tiles with the same label can reach each other, so asking "could this
+// customer ever get to that register" is a couple of label lookups instead of
+// a full search on the game thread. Only when the actual route is needed do
+// we go through the path thread.
+//
+// Everything outside the obstacle grid is open floor and shares one label.
+struct WalkableRegions {
+    static constexpr int BLOCKED = 0;
+    static constexpr int OUTSIDE = 1;
+
+    ObstacleGrid grid;
+    // One per grid tile, BLOCKED or a region label
+    std::vector<int> labels;
+    int num_regions = 0;
+    // Bumped on every relabel, 0 means never built
+    size_t generation = 0;
+
+    [[nodiscard]] bool built() const { return generation > 0; }
+
+    // Relabels if the obstacles moved since last time, returns true if it did
+    bool update_if_changed(const std::vector<vec2>& obstacles);
+
+    [[nodiscard]] int label_at_tile(int tx, int ty) const;
+    [[nodiscard]] int label_at(vec2 pos) const {
+        return label_at_tile(ObstacleGrid::to_tile(pos.x),
+                             ObstacleGrid::to_tile(pos.y));
+    }
+
+    // Same answer as !bfs::find_path(start, goal, ...).empty() on this grid,
+    // minus the bfs's search radius cap
+    [[nodiscard]] bool can_reach(vec2 start, vec2 goal) const;
+
+   private:
+    void relabel();
+};
+
+namespace walkable_regions {
+
+// Server game thread, kept up to date alongside the path thread's obstacle
+// grid
+WalkableRegions& get();
+
+// Uses the labels when they exist and we are on the server, otherwise falls
+// back to a full search
+[[nodiscard]] bool can_reach(vec2 start, vec2 goal);
+
+}  // namespace walkable_regions
@@ -98,6 +98,16 @@ Entity& EntityHelper::createEntityWithOptions(
     ah_options.is_permanent = options.is_permanent;
 
     Entity& e = collection.createEntityWithOptions(ah_options);
+
+    // Afterhours appends new entities to the temp list, so this is almost
+    // always the last one
+    const auto& temp = collection.get_temp();
+    for (auto it = temp.rbegin(); it != temp.rend(); ++it) {
+        if (it->get() != &e) continue;
+        pending_index_for_current()[e.id] = *it;
+        break;
+    }
+
     EntityHelper::invalidatePathCache();
     return e;
 
@@ -113,6 +123,17 @@ Entity& EntityHelper::createEntityWithOptions(
     // cache_is_walkable.clear();
 }
 
+void EntityHelper::prunePendingIndex() {
+    PendingIndex& pending = pending_index_for_current();
+    if (pending.empty()) return;
+    auto& collection = EntityHelper::get_current_collection();
+    std::erase_if(pending, [&](const auto& kv) {
+        std::shared_ptr<Entity> sp = kv.second.lock();
+        if (!sp || sp->id != kv.first) return true;
+        return collection.getEntityForID(kv.first).has_value();
+    });
+}
+
 enum ForEachFlow {
     NormalFlow = 0,
     Continue = 1,
@@ -151,6 +172,7 @@ void EntityHelper::forEachEntity(
 //
 void EntityHelper::invalidateCaches() {
     named_entities_DO_NOT_USE.clear();
+    invalidateReferences();
     EntityHelper::invalidatePathCache();
 }
 
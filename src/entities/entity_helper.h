@@ -1,7 +1,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <thread>
+#include <unordered_map>
 
 #include "components/can_hold_item.h"
 #include "components/is_floor_marker.h"
@@ -58,19 +60,21 @@ struct EntityHelper : afterhours::EntityHelper {
         // entities into `temp_entities` and then immediately resolve by ID
         // within the same tick, before the usual per-system merge.
         //
-        // To preserve historical behavior (and avoid relying on forced merges
-        // mid-system), fall back to checking temp entities if the O(1) lookup
-        // misses.
+        // Those get registered in the pending index when they are created so
+        // a miss here is a hash lookup instead of a scan over every entity
+        // created this tick.
         OptEntity merged = get_current_collection().getEntityForID(id);
         if (merged) return merged;
 
-        for (const auto& sp : get_current_collection().get_temp()) {
-            if (!sp) continue;
-            if (sp->id == id) {
-                return *sp;
-            }
-        }
-        return {};
+        const PendingIndex& pending = pending_index_for_current();
+        auto it = pending.find(id);
+        if (it == pending.end()) return {};
+        // Expired means it was created and deleted again before anyone
+        // merged it. A different id means the object was reused for another
+        // entity (snapshot decode recycles them)
+        std::shared_ptr<Entity> sp = it->second.lock();
+        if (!sp || sp->id != id) return {};
+        return *sp;
     }
 
     // Like getEntityForID, but asserts when missing.
@@ -142,10 +146,62 @@ struct EntityHelper : afterhours::EntityHelper {
     static void delete_all_entities_NO_REALLY_I_MEAN_ALL() {
         EntityHelper::get_current_collection()
             .delete_all_entities_NO_REALLY_I_MEAN_ALL();
+        pending_index_for_current().clear();
+        invalidateSlots();
+        invalidateReferences();
     }
     static void delete_all_entities(bool include_permanent = false) {
         EntityHelper::get_current_collection().delete_all_entities(
             include_permanent);
+        prunePendingIndex();
+        invalidateSlots();
+        invalidateReferences();
+    }
+
+    // Entities created this tick that afterhours has not merged yet, by id.
+    // Entries are dropped by prunePendingIndex() once the entity is either
+    // merged (and so in afterhours' own id map) or gone.
+    using PendingIndex =
+        std::unordered_map<afterhours::EntityID, std::weak_ptr<Entity>>;
+    static PendingIndex& pending_index_for_current() {
+        static PendingIndex server_pending;
+        static PendingIndex client_pending;
+        return is_server() ? server_pending : client_pending;
+    }
+    static void prunePendingIndex();
+
+    // Bumped whenever raw references into the current collection might have
+    // gone stale (every tick, world replaced / regenerated). One per
+    // collection so job pool workers running server systems see the server's
+    // count.
+    static std::atomic<size_t>& reference_generation_for_current() {
+        static std::atomic<size_t> server_generation{1};
+        static std::atomic<size_t> client_generation{1};
+        return is_server() ? server_generation : client_generation;
+    }
+    [[nodiscard]] static size_t reference_generation() {
+        return reference_generation_for_current().load(
+            std::memory_order_relaxed);
+    }
+    static void invalidateReferences() {
+        reference_generation_for_current().fetch_add(
+            1, std::memory_order_relaxed);
+    }
+
+    // Bumped when the collection is rebuilt wholesale and slots get handed
+    // out from scratch. Individual deletes don't need this, the slot
+    // generation already catches those. EntityRef drops cached handles from
+    // an older epoch.
+    static std::atomic<uint32_t>& slot_epoch_for_current() {
+        static std::atomic<uint32_t> server_epoch{1};
+        static std::atomic<uint32_t> client_epoch{1};
+        return is_server() ? server_epoch : client_epoch;
+    }
+    [[nodiscard]] static uint32_t slot_epoch() {
+        return slot_epoch_for_current().load(std::memory_order_relaxed);
+    }
+    static void invalidateSlots() {
+        slot_epoch_for_current().fetch_add(1, std::memory_order_relaxed);
     }
 
     // Entity iteration
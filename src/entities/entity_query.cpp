@@ -5,7 +5,7 @@
 #include "components/can_hold_item.h"
 #include "components/is_drink.h"
 #include "engine/assert.h"
-#include "engine/pathfinder.h"
+#include "engine/walkable_regions.h"
 #include "entity_helper.h"
 
 EQ::EQ(const EQ& other)
@@ -22,10 +22,9 @@ EQ::EQ(const EQ& other)
 }
 
 bool EQ::WhereCanPathfindTo::operator()(const Entity& entity) const {
-    return !pathfinder::find_path(
-                start, entity.get<Transform>().tile_directly_infront(),
-                std::bind(EntityHelper::isWalkable, std::placeholders::_1))
-                .empty();
+    // Only asks if there is a route, the actual path is requested later
+    return walkable_regions::can_reach(
+        start, entity.get<Transform>().tile_directly_infront());
 }
 
 EQ& EQ::whereIsHoldingAnyFurniture() {
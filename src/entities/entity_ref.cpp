@@ -2,25 +2,70 @@
 
 #include "entity_helper.h"
 
-void EntityRef::set(Entity& e) {
-    id = e.id;
+namespace {
+static_assert(sizeof(afterhours::EntityHandle::slot) <= sizeof(std::uint32_t) &&
+                  sizeof(afterhours::EntityHandle::gen) <=
+                      sizeof(std::uint32_t),
+              "EntityRef packs slot and gen into one 64 bit atomic");
+
+std::uint64_t pack(const afterhours::EntityHandle& h) {
+    return (static_cast<std::uint64_t>(h.slot) << 32) |
+           static_cast<std::uint32_t>(h.gen);
+}
+
+afterhours::EntityHandle unpack(std::uint64_t packed) {
+    afterhours::EntityHandle h;
+    h.slot = static_cast<decltype(h.slot)>(packed >> 32);
+    h.gen = static_cast<decltype(h.gen)>(packed & 0xFFFFFFFFu);
+    return h;
+}
+
+void cache_handle(const EntityRef& ref, Entity& e) {
     // Handle will be invalid until the entity is merged/assigned a slot.
     const afterhours::EntityHandle h = EntityHelper::handle_for(e);
-    if (h.valid()) {
-        handle = h;
-    } else {
-        handle.reset();
+    if (!h.valid()) {
+        ref.cached_handle.store(EntityRef::NO_HANDLE,
+                                std::memory_order_relaxed);
+        return;
     }
+    // Two readers may race here, both store a handle for the same id so
+    // either one winning is fine, and a mixed pair is caught by the id check
+    ref.cached_handle.store(pack(h), std::memory_order_relaxed);
+    ref.handle_epoch.store(EntityHelper::slot_epoch(),
+                           std::memory_order_release);
+}
+}  // namespace
+
+void EntityRef::set(Entity& e) {
+    id = e.id;
+    cache_handle(*this, e);
 }
 
 OptEntity EntityRef::resolve() const {
-    if (handle.has_value()) {
-        OptEntity opt = EntityHelper::resolve(*handle);
-        if (opt) return opt;
+    if (id == entity_id::INVALID) return {};
+
+    if (handle_epoch.load(std::memory_order_acquire) ==
+        EntityHelper::slot_epoch()) {
+        const std::uint64_t packed =
+            cached_handle.load(std::memory_order_relaxed);
+        if (packed != NO_HANDLE) {
+            OptEntity opt = EntityHelper::resolve(unpack(packed));
+            if (opt && opt->id == id) return opt;
+            // Either deleted or the cache was mid update on another worker,
+            // the ID lookup below tells the two apart
+        }
+    }
+
+    // Not cached yet (temp entity when set, deserialized, or the world was
+    // replaced). Goes through PharmaSea's getEntityForID so pending temp
+    // entities still resolve.
+    OptEntity opt = EntityHelper::getEntityForID(id);
+    if (opt) {
+        cache_handle(*this, opt.asE());
+    } else {
+        cached_handle.store(NO_HANDLE, std::memory_order_relaxed);
     }
-    // Fallback preserves legacy behavior (including temp-entity scans via
-    // PharmaSea's EntityHelper::getEntityForID wrapper).
-    return EntityHelper::getEntityForID(id);
+    return opt;
 }
 
 Entity& EntityRef::resolve_enforced() const {
@@ -1,6 +1,7 @@
 #pragma once
 
-#include <optional>
+#include <atomic>
+#include <cstdint>
 
 #include "entity.h"
 #include "entity_id.h"
@@ -12,20 +13,42 @@
 //
 // This is intentionally compatible with existing ID-based serialization: the
 // serialized representation is just a 4-byte EntityID.
+//
+// The handle (slot + generation) is filled in lazily the first time the ID
+// resolves to a merged entity, so refs that were set on a temp entity or came
+// in over the network still end up on the fast path. Once cached:
+// - resolving is a slot index plus a generation compare
+// - a generation mismatch means the entity was deleted, no ID lookup needed
+// Slots are only meaningful within one collection layout, so the handle also
+// remembers the slot epoch it was taken in and is dropped when that changes
+// (world replaced by a snapshot, delete_all).
+//
+// resolve() is const and systems that only declare reads<> may call it on the
+// same ref from several workers at once (a register every customer targets),
+// so the cache is a pair of atomics. It is only ever a hint, whatever it
+// resolves to is checked against `id` and anything else (including a reader
+// seeing half of another reader's update) falls back to the ID lookup.
 struct EntityRef {
     EntityID id = entity_id::INVALID;
-    std::optional<afterhours::EntityHandle> handle{};
+
+    EntityRef() = default;
+    EntityRef(const EntityRef& other) : id(other.id) { copy_cache(other); }
+    EntityRef& operator=(const EntityRef& other) {
+        id = other.id;
+        copy_cache(other);
+        return *this;
+    }
 
     [[nodiscard]] bool has_value() const { return id != entity_id::INVALID; }
     [[nodiscard]] bool empty() const { return !has_value(); }
     void clear() {
         id = entity_id::INVALID;
-        handle.reset();
+        drop_cache();
     }
 
     void set_id(EntityID new_id) {
         id = new_id;
-        handle.reset();
+        drop_cache();
     }
 
     // Implemented in entity_ref.cpp to break circular dependency
@@ -35,11 +58,29 @@ struct EntityRef {
     // exist.
     [[nodiscard]] Entity& resolve_enforced() const;
 
+    // Packed slot and generation, NO_HANDLE when nothing is cached
+    static constexpr std::uint64_t NO_HANDLE = ~std::uint64_t{0};
+    mutable std::atomic<std::uint64_t> cached_handle{NO_HANDLE};
+    mutable std::atomic<std::uint32_t> handle_epoch{0};
+
+   private:
+    void copy_cache(const EntityRef& other) {
+        cached_handle.store(
+            other.cached_handle.load(std::memory_order_relaxed),
+            std::memory_order_relaxed);
+        handle_epoch.store(other.handle_epoch.load(std::memory_order_relaxed),
+                           std::memory_order_relaxed);
+    }
+    void drop_cache() {
+        cached_handle.store(NO_HANDLE, std::memory_order_relaxed);
+    }
+
    public:
     friend zpp::bits::access;
     constexpr static auto serialize(auto& archive, auto& self) {
-        // Keep persistence ID-based for now (4 bytes), even if we cache handles
-        // at runtime.
+        // Keep persistence ID-based (4 bytes). Slots differ between the
+        // server and client collections so the handle is re-derived on the
+        // receiving side on first resolve.
         return archive(  //
             self.id      //
         );
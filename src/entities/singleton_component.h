@@ -0,0 +1,62 @@
+#pragma once
+
+#include "entity_helper.h"
+#include "entity_query.h"
+
+// Typed access to components that only ever live on one entity
+// (HasDayNightTimer, IsRoundSettingsManager, IsProgressionManager, etc
+// which all sit on Sophie).
+//
+//  if (const auto* timer = Singleton<HasDayNightTimer>::get_ptr()) {...}
+//
+// The owning entity is looked up at most once per tick and then handed out
+// as a plain pointer, instead of going through the named entity map (and a
+// try/catch) on every call. The cache is dropped whenever
+// EntityHelper::invalidateReferences() is called, which happens every tick
+// and any time the world gets replaced, so the pointer never outlives the
+// entity.
+//
+// Never throws, a missing entity (menus, before the map is generated) just
+// returns nullptr.
+template<typename Component>
+struct Singleton {
+    [[nodiscard]] static Component* get_ptr() {
+        Cache& c = cache();
+        if (c.generation != EntityHelper::reference_generation()) {
+            c.generation = EntityHelper::reference_generation();
+            c.entity = resolve();
+        }
+        if (!c.entity) return nullptr;
+        return &(c.entity->template get<Component>());
+    }
+
+    [[nodiscard]] static bool exists() { return get_ptr() != nullptr; }
+
+    // The owning entity itself, for callers that need more than one of its
+    // components
+    [[nodiscard]] static OptEntity entity() {
+        get_ptr();
+        Entity* e = cache().entity;
+        if (!e) return {};
+        return *e;
+    }
+
+   private:
+    struct Cache {
+        size_t generation = 0;
+        Entity* entity = nullptr;
+    };
+
+    // thread_local since the server and client threads each have their own
+    // collection (and their own copy of sophie), job pool workers just end
+    // up with their own copy of the server's
+    static Cache& cache() {
+        static thread_local Cache c;
+        return c;
+    }
+
+    static Entity* resolve() {
+        OptEntity opt = EQ().whereHasComponent<Component>().gen_first();
+        return opt.has_value() ? opt.value() : nullptr;
+    }
+};
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <vector>
+
+#include "../components/transform.h"
+#include "entity.h"
+
+// Dense per field copy of the transforms for a small set of entities that get
+// scanned many times a tick (players for the trigger area counters).
+//
+// Afterhours keeps each component behind its entity so every EQ over oldAll
+// chases a shared_ptr and a component pointer per entity just to throw most
+// of them away. Building this once per tick and then streaming over the
+// arrays is a lot cheaper than re-filtering the whole entity list for every
+// trigger area and building.
+struct TransformStream {
+    std::vector<EntityID> ids;
+    // as2(), so x and z in world space
+    std::vector<float> xs;
+    std::vector<float> zs;
+    std::vector<BoundingBox> bounds;
+
+    void clear() {
+        ids.clear();
+        xs.clear();
+        zs.clear();
+        bounds.clear();
+    }
+
+    void push(const Entity& entity) {
+        const Transform& transform = entity.get<Transform>();
+        vec2 pos = transform.as2();
+        ids.push_back(entity.id);
+        xs.push_back(pos.x);
+        zs.push_back(pos.y);
+        bounds.push_back(transform.bounds());
+    }
+
+    template<typename Filter>
+    void rebuild(const afterhours::Entities& entities, Filter&& filter) {
+        clear();
+        for (const auto& entity : entities) {
+            if (!entity || entity->is_missing<Transform>()) continue;
+            if (!filter(*entity)) continue;
+            push(*entity);
+        }
+    }
+
+    [[nodiscard]] size_t size() const { return ids.size(); }
+
+    // Same check as EQ::whereInside
+    [[nodiscard]] size_t count_inside(vec2 min, vec2 max) const {
+        size_t count = 0;
+        for (size_t i = 0; i < xs.size(); i++) {
+            if (xs[i] > max.x || xs[i] < min.x) continue;
+            if (zs[i] > max.y || zs[i] < min.y) continue;
+            count++;
+        }
+        return count;
+    }
+
+    // Same check as EQ::whereCollides
+    [[nodiscard]] size_t count_colliding(BoundingBox box) const {
+        size_t count = 0;
+        for (const BoundingBox& b : bounds) {
+            if (CheckCollisionBoxes(b, box)) count++;
+        }
+        return count;
+    }
+};
@@ -1,6 +1,7 @@
 
 #include "game.h"
 
+#include "ai_benchmark.h"
 #include "cli_args.h"
 #include "engine/assert.h"
 #include "engine/input_helper.h"
@@ -269,6 +270,14 @@ int main(int argc, char* argv[]) {
         return 0;
     }
 
+    if (BENCH_AI) {
+        return ai_benchmark::run({
+            .seed = MAP_VIEWER_SEED.empty() ? "bench" : MAP_VIEWER_SEED,
+            .customers = BENCH_AI_CUSTOMERS,
+            .days = BENCH_AI_DAYS,
+        });
+    }
+
     if (MAP_VIEWER) {
         std::string seed =
             MAP_VIEWER_SEED.empty() ? "default_seed" : MAP_VIEWER_SEED;
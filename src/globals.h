@@ -47,6 +47,9 @@ extern std::string MAP_VIEWER_SEED;
 extern bool TEST_MAP_GENERATION;
 extern bool GENERATE_MAP;
 extern std::string GENERATE_MAP_SEED;
+extern bool BENCH_AI;
+extern int BENCH_AI_CUSTOMERS;
+extern int BENCH_AI_DAYS;
 
 // TODO :BE: is there a way for us to move these to engine
 // and then let the game pass them in or something _while_ staying const?
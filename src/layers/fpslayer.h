@@ -1,10 +1,16 @@
 #pragma once
 
 #include "../engine/layer.h"
+#include "../engine/path_cache.h"
 #include "../engine/profile.h"
 #include "../engine/runtime_globals.h"
+#include "../engine/tick_scheduler.h"
 #include "../external_include.h"
 #include "../preload.h"
+#include "../serialization/world_snapshot_blob.h"
+#include "../system/core/system_groups.h"
+#include "../system/rendering/render_culling.h"
+#include "../system/rendering/static_geometry.h"
 #include "raylib.h"
 
 using namespace profile;
@@ -17,6 +23,14 @@ struct FPSLayer : public Layer {
         ext::draw_fps(0, 0);
 
         if (globals::debug_ui_enabled()) {
+            // Stacked upward from the bottom left corner
+            float stats_y = WIN_HF() - LINE_HEIGHT;
+            stats_y = draw_culling_stats(stats_y);
+            stats_y = draw_decode_stats(stats_y);
+            stats_y = draw_path_cache_stats(stats_y);
+            (void) draw_tick_stats(stats_y);
+            draw_system_timings();
+
             std::vector<Sample> pairs;
             pairs.insert(pairs.end(), Profiler::get()._acc.begin(),
                          Profiler::get()._acc.end());
@@ -41,4 +55,102 @@ struct FPSLayer : public Layer {
             }
         }
     }
+
+    void draw_system_timings() {
+        std::vector<std::pair<std::string, float>> lines;
+        for (const system_groups::Timing& t : system_groups::group_timings()) {
+            lines.emplace_back(fmt::format("[{}]", t.name), t.avg_ms.load());
+        }
+
+        // Only the slowest few systems, the full list doesnt fit
+        constexpr size_t MAX_SYSTEMS = 8;
+        std::vector<std::pair<std::string, float>> sys;
+        for (const system_groups::Timing& t : system_groups::system_timings()) {
+            sys.emplace_back(t.name, t.avg_ms.load());
+        }
+        sort(sys.begin(), sys.end(),
+             [](const auto& a, const auto& b) { return a.second > b.second; });
+        if (sys.size() > MAX_SYSTEMS) sys.resize(MAX_SYSTEMS);
+        lines.insert(lines.end(), sys.begin(), sys.end());
+
+        float ypos = 0.f;
+        for (const auto& [name, ms] : lines) {
+            std::string stat_str = fmt::format("{}: {:.3f}ms", name, ms);
+            int string_width = raylib::MeasureText(stat_str.c_str(), 15);
+            float xpos = WIN_WF() - (float) string_width;
+            DrawRectangle((int) xpos, (int) ypos, string_width, 20, BLACK);
+            DrawTextEx(Preload::get().font, stat_str.c_str(), vec2{xpos, ypos},
+                       20, 0, WHITE);
+            ypos += 20.f;
+        }
+    }
+
+    static constexpr float LINE_HEIGHT = 20.f;
+
+    void draw_stat_line(const std::string& stat_str, float ypos) {
+        int string_width = raylib::MeasureText(stat_str.c_str(), 15);
+        DrawRectangle(0, (int) ypos, string_width, (int) LINE_HEIGHT, BLACK);
+        DrawTextEx(Preload::get().font, stat_str.c_str(), vec2{0, ypos},
+                   LINE_HEIGHT, 0, WHITE);
+    }
+
+    // Each of these draws at `ypos` and returns where the next line goes
+
+    [[nodiscard]] float draw_culling_stats(float ypos) {
+        const system_manager::render_manager::CullingStats& stats =
+            system_manager::render_manager::last_culling_stats();
+        const system_manager::render_manager::StaticGeometryStats& baked =
+            system_manager::render_manager::static_geometry_stats();
+        draw_stat_line(
+            fmt::format("drawn {} culled {} cached {} cells {}/{} baked walls "
+                        "{} meshes {}/{}",
+                        stats.drawn, stats.culled, stats.cached,
+                        stats.cells_visible, stats.cells_total, baked.walls,
+                        baked.meshes_drawn, baked.meshes),
+            ypos);
+        return ypos - LINE_HEIGHT;
+    }
+
+    [[nodiscard]] float draw_decode_stats(float ypos) {
+        // Snapshots are decoded on this thread so these are the client's
+        const snapshot_blob::DecodeAllocStats stats =
+            snapshot_blob::last_decode_alloc_stats();
+        draw_stat_line(
+            fmt::format(
+                "snapshot entities new {} reused {} components new {} reused "
+                "{}",
+                stats.entities_allocated, stats.entities_reused,
+                stats.components_allocated, stats.components_reused),
+            ypos);
+        return ypos - LINE_HEIGHT;
+    }
+
+    [[nodiscard]] float draw_path_cache_stats(float ypos) {
+        // Only filled in when hosting
+        const PathCacheStats& stats = PathCache::get_stats();
+        draw_stat_line(
+            fmt::format(
+                "path cache hits {} misses {} ({:.0f}%) evicted {} size {}",
+                stats.hits.load(), stats.misses.load(),
+                100.f * stats.hit_rate(), stats.evictions.load(),
+                stats.size.load()),
+            ypos);
+        return ypos - LINE_HEIGHT;
+    }
+
+    [[nodiscard]] float draw_tick_stats(float ypos) {
+        // Server and path threads, only filled in when hosting
+        TickStats::for_each([&](const TickStats& stats) {
+            draw_stat_line(
+                fmt::format("{} {:.0f}hz util {:.0f}% avg {:.2f}ms overruns {} "
+                            "dropped {}",
+                            stats.name, stats.hz,
+                            100.f * stats.utilization.load(),
+                            stats.avg_tick_ms.load(), stats.overruns.load(),
+                            stats.dropped.load()),
+                ypos);
+            ypos -= LINE_HEIGHT;
+        });
+        return ypos;
+    }
 };
@@ -5,6 +5,7 @@
 #include "../components/is_progression_manager.h"
 #include "../dataclass/ingredient.h"
 #include "../engine/input_utilities.h"
+#include "../engine/settings.h"
 #include "../entities/entity_helper.h"
 #include "../entities/entity_query.h"
 #include "../libraries/recipe_library.h"
@@ -42,6 +43,32 @@ Drink get_drink_for_selected_id(int selected_recipe) {
     return magic_enum::enum_value<Drink>(drink_index);
 }
 
+size_t RecipeBookLayer::page_signature() const {
+    size_t signature = 0;
+    std::hash_combine(signature, selected_recipe);
+    std::hash_combine(signature, Settings::get().data.lang_name);
+
+    auto ent = get_ipm_entity();
+    if (ent) {
+        std::hash_combine(signature,
+                          ent->get<IsProgressionManager>().enabled_drinks());
+    }
+    return signature;
+}
+
+void RecipeBookLayer::onDraw(float dt) {
+    if (!baseShouldRender()) return;
+
+    if (page_cache.begin_if_stale(page_signature())) {
+        using namespace ui;
+        begin(ui_context, dt);
+        onDrawUI(dt);
+        end();
+        page_cache.end();
+    }
+    page_cache.draw();
+}
+
 void RecipeBookLayer::onDrawUI(float) {
     using namespace ui;
 
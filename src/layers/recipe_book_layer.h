@@ -16,9 +16,13 @@ struct RecipeBookLayer : public BaseGameRendererLayer {
 
     int selected_recipe = 0;
 
+    // The page only changes when you flip it, unlock a recipe or change
+    // language, so we keep the last drawn page around and blit it
+    RetainedRenderTexture page_cache;
+
     RecipeBookLayer() : BaseGameRendererLayer("RecipeBook") {}
 
-    virtual ~RecipeBookLayer() {}
+    virtual ~RecipeBookLayer() { page_cache.unload(); }
 
     virtual bool shouldSkipRender() override { return !shouldRender(); }
     bool shouldRender() { return should_show_recipes; }
@@ -82,5 +86,8 @@ struct RecipeBookLayer : public BaseGameRendererLayer {
         handleInput();
     }
 
+    [[nodiscard]] size_t page_signature() const;
+
+    virtual void onDraw(float dt) override;
     virtual void onDrawUI(float) override;
 };
@@ -2,10 +2,13 @@
 #include "seedmanagerlayer.h"
 
 #include "../ah.h"
+#include "../components/transform.h"
 #include "../dataclass/names.h"
 #include "../engine/input_helper.h"
 #include "../engine/input_utilities.h"
 #include "../engine/runtime_globals.h"
+#include "../entities/entity_helper.h"
+#include "../map.h"
 #include "../network/network.h"
 
 bool SeedManagerLayer::is_user_host() {
@@ -106,17 +109,39 @@ void SeedManagerLayer::draw_seed_input(float dt) {
     end();
 }
 
+size_t SeedManagerLayer::minimap_signature() const {
+    size_t signature = 0;
+    std::hash_combine(signature, map_ptr->seed);
+
+    // At this scale a tile is a couple pixels, so only moving into another
+    // tile (or spawning / deleting something) is worth a redraw
+    const auto& entities = EntityHelper::get_entities();
+    std::hash_combine(signature, entities.size());
+    for (const auto& sp : entities) {
+        if (!sp || sp->is_missing<Transform>()) continue;
+        vec2 pos = sp->get<Transform>().as2();
+        std::hash_combine(signature, sp->id);
+        std::hash_combine(signature, (int) floorf(pos.x));
+        std::hash_combine(signature, (int) floorf(pos.y));
+    }
+    return signature;
+}
+
 void SeedManagerLayer::draw_minimap(float dt) {
-    raylib::BeginMode3D((*cam).get());
-    {
-        raylib::rlTranslatef(-5, 0, 7.f);
-        float scale = 0.10f;
-        raylib::rlScalef(scale, scale, scale);
-        raylib::DrawPlane((vec3) {0.0f, -TILESIZE, 0.0f}, (vec2) {40.0f, 40.0f},
-                          DARKGRAY);
-        map_ptr->onDraw(dt);
+    if (minimap_cache.begin_if_stale(minimap_signature())) {
+        raylib::BeginMode3D((*cam).get());
+        {
+            raylib::rlTranslatef(-5, 0, 7.f);
+            float scale = 0.10f;
+            raylib::rlScalef(scale, scale, scale);
+            raylib::DrawPlane((vec3) {0.0f, -TILESIZE, 0.0f},
+                              (vec2) {40.0f, 40.0f}, DARKGRAY);
+            map_ptr->onDraw(dt);
+        }
+        raylib::EndMode3D();
+        minimap_cache.end();
     }
-    raylib::EndMode3D();
+    minimap_cache.draw();
 }
 
 void SeedManagerLayer::onDraw(float dt) {
@@ -12,6 +12,9 @@ struct SeedManagerLayer : public Layer {
     // We use a temp string because we dont want to touch the real one until the
     // user says Okay
     std::string tempSeed;
+    // The minimap is the whole world drawn a second time, so only redraw it
+    // when something on it changed
+    RetainedRenderTexture minimap_cache;
 
     SeedManagerLayer()
         : Layer(strings::menu::GAME),
@@ -22,12 +25,13 @@ struct SeedManagerLayer : public Layer {
         cam->free_distance_max_clamp = 200.0f;
     }
 
-    virtual ~SeedManagerLayer() {}
+    virtual ~SeedManagerLayer() { minimap_cache.unload(); }
 
     bool is_user_host();
     void handleInput();
     virtual void onUpdate(float) override;
     void draw_seed_input(float dt);
+    [[nodiscard]] size_t minimap_signature() const;
     void draw_minimap(float dt);
     virtual void onDraw(float dt) override;
 };
@@ -3,6 +3,8 @@
 #include <array>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
+#include <unordered_map>
 
 #include "building_locations.h"
 #include "components/transform.h"
@@ -10,6 +12,7 @@
 #include "entities/entity_query.h"
 #include "entities/entity_type.h"
 #include "system/core/system_manager.h"
+#include "system/rendering/wall_set_tracker.h"
 
 namespace {
 
@@ -35,22 +38,50 @@ struct Phase1LightingTuning {
 
 static const Phase1LightingTuning PHASE1{};
 
-inline void set_vec3(raylib::Shader& s, int loc, const vec3& v) {
-    raylib::SetShaderValue(s, loc, &v, raylib::SHADER_UNIFORM_VEC3);
-}
+// Remembers what we last sent for each uniform location so unchanged values
+// (which is almost all of them, almost every frame) never hit the driver.
+struct UniformUploader {
+    unsigned int shader_id = 0;
+    std::unordered_map<int, std::vector<unsigned char>> last_uploaded;
+    size_t num_uploads = 0;
 
-inline void set_int(raylib::Shader& s, int loc, int v) {
-    raylib::SetShaderValue(s, loc, &v, raylib::SHADER_UNIFORM_INT);
-}
+    void reset(unsigned int id) {
+        shader_id = id;
+        last_uploaded.clear();
+    }
 
-inline void set_float(raylib::Shader& s, int loc, float v) {
-    raylib::SetShaderValue(s, loc, &v, raylib::SHADER_UNIFORM_FLOAT);
-}
+    template<typename T>
+    void set(raylib::Shader& s, int loc, const T* data, int uniform_type,
+             int count = 1) {
+        if (loc < 0) return;
+        const size_t bytes = sizeof(T) * static_cast<size_t>(count);
+        const auto* raw = reinterpret_cast<const unsigned char*>(data);
 
-inline void set_bool(raylib::Shader& s, int loc, bool v) {
-    int iv = v ? 1 : 0;
-    raylib::SetShaderValue(s, loc, &iv, raylib::SHADER_UNIFORM_INT);
-}
+        std::vector<unsigned char>& last = last_uploaded[loc];
+        if (last.size() == bytes && std::memcmp(last.data(), raw, bytes) == 0)
+            return;
+        last.assign(raw, raw + bytes);
+
+        raylib::SetShaderValueV(s, loc, data, uniform_type, count);
+        num_uploads++;
+    }
+
+    void set_vec3(raylib::Shader& s, int loc, const vec3& v) {
+        set(s, loc, &v, raylib::SHADER_UNIFORM_VEC3);
+    }
+
+    void set_int(raylib::Shader& s, int loc, int v) {
+        set(s, loc, &v, raylib::SHADER_UNIFORM_INT);
+    }
+
+    void set_float(raylib::Shader& s, int loc, float v) {
+        set(s, loc, &v, raylib::SHADER_UNIFORM_FLOAT);
+    }
+
+    void set_bool(raylib::Shader& s, int loc, bool v) {
+        set_int(s, loc, v ? 1 : 0);
+    }
+};
 
 struct LightingUniforms {
     int viewPos = -1;
@@ -68,11 +99,10 @@ struct LightingUniforms {
     int roofRects = -1;
 
     int pointLightCount = -1;
-    int lightsPerBuilding = -1;
     int lightRectCount = -1;
     int lightRects = -1;
-    int pointLightsPosRadius = -1;
-    int pointLightsColor = -1;
+    int lightRanges = -1;
+    int pointLights = -1;
 };
 
 inline LightingUniforms get_lighting_uniforms(raylib::Shader& s) {
@@ -92,51 +122,86 @@ inline LightingUniforms get_lighting_uniforms(raylib::Shader& s) {
     u.roofRectCount = raylib::GetShaderLocation(s, "roofRectCount");
     u.roofRects = raylib::GetShaderLocation(s, "roofRects");
     u.pointLightCount = raylib::GetShaderLocation(s, "pointLightCount");
-    u.lightsPerBuilding = raylib::GetShaderLocation(s, "lightsPerBuilding");
     u.lightRectCount = raylib::GetShaderLocation(s, "lightRectCount");
     u.lightRects = raylib::GetShaderLocation(s, "lightRects");
-    u.pointLightsPosRadius =
-        raylib::GetShaderLocation(s, "pointLightsPosRadius");
-    u.pointLightsColor = raylib::GetShaderLocation(s, "pointLightsColor");
+    u.lightRanges = raylib::GetShaderLocation(s, "lightRanges");
+    u.pointLights = raylib::GetShaderLocation(s, "pointLights");
     return u;
 }
 
-struct IndoorLightLayout {
-    static constexpr int kBuildings = 6;
-    static constexpr int kLightsPerBuilding = 10;
-    static constexpr int kTotalLights = kBuildings * kLightsPerBuilding;
+struct LightingRuntime {
+    LightingUniforms uniforms;
+    UniformUploader uploader;
 
-    bool initialized = false;
-    // Light rects used for indoor lights (can be tighter than roofRects)
-    std::array<vec4, kBuildings> light_rects{};
-    std::array<vec4, kTotalLights> lights_pos_radius{};
-    std::array<vec3, kTotalLights> lights_color{};
+    // Inputs the light list was built from
+    bool has_lights = false;
+    bool lights_for_night = false;
+    size_t wall_generation = 0;
+    vec4 bar_rect{};
+    lighting::LightList lights;
 };
 
-static IndoorLightLayout g_indoor_layout{};
+static LightingRuntime g_runtime{};
 
 inline vec4 building_rect_minmax(const Building& b) {
     // minX, minZ, maxX, maxZ
     return {b.min().x, b.min().y, b.max().x, b.max().y};
 }
 
-inline vec4 compute_bar_light_rect_from_walls() {
-    // Bar building can be larger than actual placed walls.
-    // Find wall tiles inside BAR_BUILDING bounds and compute a tight interior
-    // rect.
+inline std::vector<vec2> bar_wall_positions() {
     const auto walls = EntityQuery()
                            .whereType(EntityType::Wall)
                            .whereInside(BAR_BUILDING.min(), BAR_BUILDING.max())
                            .gen();
 
-    if (walls.empty()) {
+    std::vector<vec2> positions;
+    positions.reserve(walls.size());
+    for (const Entity& w : walls) {
+        if (w.is_missing<Transform>()) continue;
+        positions.push_back(w.get<Transform>().as2());
+    }
+    return positions;
+}
+
+// Walls only change when the map does
+inline size_t current_wall_generation() {
+    return system_manager::render_manager::wall_set_generation();
+}
+
+inline void refresh_lights(bool is_night) {
+    size_t generation = current_wall_generation();
+    bool walls_changed =
+        !g_runtime.has_lights || generation != g_runtime.wall_generation;
+    if (walls_changed) {
+        g_runtime.bar_rect = lighting::bar_light_rect(bar_wall_positions());
+        g_runtime.wall_generation = generation;
+    }
+
+    if (!walls_changed && g_runtime.has_lights &&
+        g_runtime.lights_for_night == is_night) {
+        return;
+    }
+
+    g_runtime.lights =
+        lighting::gather_indoor_lights(g_runtime.bar_rect, is_night);
+    g_runtime.lights_for_night = is_night;
+    g_runtime.has_lights = true;
+}
+
+}  // namespace
+
+namespace lighting {
+
+vec4 bar_light_rect(const std::vector<vec2>& wall_positions) {
+    // Bar building can be larger than actual placed walls.
+    // Use the wall tiles inside BAR_BUILDING bounds to compute a tight
+    // interior rect.
+    if (wall_positions.empty()) {
         return building_rect_minmax(BAR_BUILDING);
     }
 
     float minx = 1e9f, minz = 1e9f, maxx = -1e9f, maxz = -1e9f;
-    for (const Entity& w : walls) {
-        if (w.is_missing<Transform>()) continue;
-        vec2 p = w.get<Transform>().as2();
+    for (const vec2& p : wall_positions) {
         minx = fmin(minx, p.x);
         minz = fmin(minz, p.y);
         maxx = fmax(maxx, p.x);
@@ -153,15 +218,25 @@ inline vec4 compute_bar_light_rect_from_walls() {
     return r;
 }
 
-inline void rebuild_indoor_light_layout() {
-    // Build rects (roof rectangles for light placement). Only bar needs
-    // special-case today.
-    g_indoor_layout.light_rects[0] = building_rect_minmax(LOBBY_BUILDING);
-    g_indoor_layout.light_rects[1] = building_rect_minmax(MODEL_TEST_BUILDING);
-    g_indoor_layout.light_rects[2] = building_rect_minmax(PROGRESSION_BUILDING);
-    g_indoor_layout.light_rects[3] = building_rect_minmax(STORE_BUILDING);
-    g_indoor_layout.light_rects[4] = compute_bar_light_rect_from_walls();
-    g_indoor_layout.light_rects[5] = building_rect_minmax(LOAD_SAVE_BUILDING);
+LightList gather_indoor_lights(const vec4& bar_rect, bool is_night) {
+    LightList list;
+
+    // Order must match the building index the shader gets from lightRects
+    const std::array<vec4, NUM_BUILDINGS> rects = {
+        building_rect_minmax(LOBBY_BUILDING),
+        building_rect_minmax(MODEL_TEST_BUILDING),
+        building_rect_minmax(PROGRESSION_BUILDING),
+        building_rect_minmax(STORE_BUILDING),
+        bar_rect,
+        building_rect_minmax(LOAD_SAVE_BUILDING),
+    };
+
+    // Colors per building (can be unified later).
+    const std::array<vec3, NUM_BUILDINGS> colors = {
+        vec3{0.95f, 0.90f, 1.00f}, vec3{1.00f, 0.85f, 0.65f},
+        vec3{0.80f, 1.00f, 0.85f}, vec3{0.85f, 0.92f, 1.00f},
+        vec3{1.00f, 0.78f, 0.55f}, vec3{0.95f, 0.85f, 0.70f},
+    };
 
     const auto radius_for_rect = [](const vec4& r) -> float {
         float w = r.z - r.x;
@@ -170,79 +245,104 @@ inline void rebuild_indoor_light_layout() {
         return fmax(6.0f, 0.45f * min_dim);
     };
 
-    const auto fill_building = [&](int building_index, const vec4& rect,
-                                   const vec3& color) {
+    // Add deterministic jitter per light to make positions less "grid
+    // obvious".
+    const auto jitter = [](int seed) -> float {
+        // Simple hash -> [-0.35, 0.35]
+        uint32_t x = (uint32_t) (seed * 2654435761u);
+        x ^= x >> 16;
+        float t = (x & 1023u) / 1023.0f;
+        return (t - 0.5f) * 0.7f;
+    };
+
+    const auto fill_building = [&](int building_index, int columns, int rows,
+                                   float z_start, float z_end) {
+        const vec4& rect = rects[building_index];
         const float minx = rect.x;
         const float minz = rect.y;
         const float maxx = rect.z;
         const float maxz = rect.w;
-
-        // 5 x positions, 2 z positions (10 lights per building).
-        const float xs[5] = {0.12f, 0.30f, 0.50f, 0.70f, 0.88f};
-        const float zs[2] = {0.33f, 0.66f};
         const float ly = 4.0f;
         const float r = radius_for_rect(rect);
 
-        // Add deterministic jitter per light to make positions less "grid
-        // obvious".
-        auto jitter = [](int seed) -> float {
-            // Simple hash -> [-0.35, 0.35]
-            uint32_t x = (uint32_t) (seed * 2654435761u);
-            x ^= x >> 16;
-            float t = (x & 1023u) / 1023.0f;
-            return (t - 0.5f) * 0.7f;
-        };
-
-        int base = building_index * IndoorLightLayout::kLightsPerBuilding;
-        int k = 0;
-        for (int zi = 0; zi < 2; zi++) {
-            for (int xi = 0; xi < 5; xi++) {
-                const int idx = base + k;
-                const float jx = jitter(idx * 2 + 1);
-                const float jz = jitter(idx * 2 + 2);
-                float x = util::lerp(minx, maxx, xs[xi]) + (0.35f * jx);
-                float z = util::lerp(minz, maxz, zs[zi]) + (0.35f * jz);
+        // Base indoor lights: keep intensity modest (no runtime boost).
+        // More lights in the same room share the same total brightness.
+        float intensity = 0.9f * (float) LIGHTS_PER_BUILDING /
+                          (float) (columns * rows);
+        // Daytime goal: make inside/outside feel similar in brightness.
+        // Boost only indoor point lights during the day (doesn't affect
+        // outdoors due to rect culling).
+        if (!is_night) intensity *= 1.60f;
+        const vec3& color = colors[building_index];
+
+        const int first = list.light_count;
+        for (int zi = 0; zi < rows; zi++) {
+            for (int xi = 0; xi < columns; xi++) {
+                const int k = zi * columns + xi;
+                const int seed = building_index * LIGHTS_PER_BUILDING + k;
+                const float jx = jitter(seed * 2 + 1);
+                const float jz = jitter(seed * 2 + 2);
+
+                const float fx =
+                    util::lerp(0.12f, 0.88f, (float) xi / (float) (columns - 1));
+                const float fz =
+                    util::lerp(z_start, z_end, (float) zi / (float) (rows - 1));
+                float x = util::lerp(minx, maxx, fx) + (0.35f * jx);
+                float z = util::lerp(minz, maxz, fz) + (0.35f * jz);
                 // Clamp inside the rect
                 x = util::clamp(x, minx + 0.25f, maxx - 0.25f);
                 z = util::clamp(z, minz + 0.25f, maxz - 0.25f);
-                g_indoor_layout.lights_pos_radius[idx] = vec4{x, ly, z, r};
-                // Base indoor lights: keep intensity modest (no runtime boost).
-                // If you want brighter/dimmer, tune this scalar.
-                constexpr float indoor_intensity = 0.9f;
-                g_indoor_layout.lights_color[idx] =
-                    vec3{color.x * indoor_intensity, color.y * indoor_intensity,
-                         color.z * indoor_intensity};
-                k++;
+
+                const int idx = list.light_count++;
+                list.packed[idx * 2] = vec4{x, ly, z, r};
+                list.packed[idx * 2 + 1] =
+                    vec4{color.x * intensity, color.y * intensity,
+                         color.z * intensity, 0.f};
             }
         }
+        list.ranges[building_index] = {first, list.light_count - first};
     };
 
-    // Colors per building (can be unified later).
-    fill_building(0, g_indoor_layout.light_rects[0], vec3{0.95f, 0.90f, 1.00f});
-    fill_building(1, g_indoor_layout.light_rects[1], vec3{1.00f, 0.85f, 0.65f});
-    fill_building(2, g_indoor_layout.light_rects[2], vec3{0.80f, 1.00f, 0.85f});
-    fill_building(3, g_indoor_layout.light_rects[3], vec3{0.85f, 0.92f, 1.00f});
-    fill_building(4, g_indoor_layout.light_rects[4], vec3{1.00f, 0.78f, 0.55f});
-    fill_building(5, g_indoor_layout.light_rects[5], vec3{0.95f, 0.85f, 0.70f});
-
-    g_indoor_layout.initialized = true;
+    list.rect_count = NUM_BUILDINGS;
+    for (int b = 0; b < NUM_BUILDINGS; b++) {
+        list.rects[b] = rects[b];
+    }
+
+    // At night, only BAR_BUILDING lights remain on; other buildings are
+    // closed, so the bar gets the room for a denser grid.
+    if (is_night) {
+        fill_building(BAR_BUILDING_INDEX, NIGHT_BAR_LIGHTS / 4, 4, 0.2f, 0.8f);
+        return list;
+    }
+
+    // 5 x positions, 2 z positions (10 lights per building).
+    for (int b = 0; b < NUM_BUILDINGS; b++) {
+        fill_building(b, LIGHTS_PER_BUILDING / 2, 2, 0.33f, 0.66f);
+    }
+    return list;
 }
 
-}  // namespace
+}  // namespace lighting
 
 void update_lighting_shader(raylib::Shader& shader,
                             const raylib::Camera3D& cam) {
-    static LightingUniforms u = get_lighting_uniforms(shader);
+    // Uniform locations and cached values only make sense for one program
+    if (g_runtime.uploader.shader_id != shader.id) {
+        g_runtime.uniforms = get_lighting_uniforms(shader);
+        g_runtime.uploader.reset(shader.id);
+    }
+    const LightingUniforms& u = g_runtime.uniforms;
+    UniformUploader& up = g_runtime.uploader;
 
     // Camera
-    set_vec3(shader, u.viewPos, cam.position);
+    up.set_vec3(shader, u.viewPos, cam.position);
 
     // Sun
     const bool is_night = SystemManager::get().is_bar_open();
     vec3 sun_color = is_night ? vec3{0.0f, 0.0f, 0.0f} : PHASE1.sun_color;
-    set_int(shader, u.lightType, PHASE1.light_type);
-    set_vec3(shader, u.lightDir, PHASE1.sun_dir);
-    set_vec3(shader, u.lightPos, PHASE1.sun_pos);
+    up.set_int(shader, u.lightType, PHASE1.light_type);
+    up.set_vec3(shader, u.lightDir, PHASE1.sun_dir);
+    up.set_vec3(shader, u.lightPos, PHASE1.sun_pos);
     // Daytime should read as bright. Boost ambient + sun only during the day.
     vec3 ambient = PHASE1.ambient;
     float sun_diffuse_intensity = PHASE1.sun_diffuse_intensity;
@@ -262,84 +362,43 @@ void update_lighting_shader(raylib::Shader& shader,
                          sun_color.z * kDaySunColorBoost};
     }
 
-    set_vec3(shader, u.lightColor, sun_color);
-    set_vec3(shader, u.ambientColor, ambient);
+    up.set_vec3(shader, u.lightColor, sun_color);
+    up.set_vec3(shader, u.ambientColor, ambient);
 
-    set_float(shader, u.shininess, PHASE1.shininess);
-    set_bool(shader, u.useHalfLambert, PHASE1.use_half_lambert);
-    set_float(shader, u.sunDiffuseIntensity, sun_diffuse_intensity);
-    set_float(shader, u.sunSpecIntensity, sun_spec_intensity);
-    set_float(shader, u.pointDiffuseIntensity, PHASE1.point_diffuse_intensity);
+    up.set_float(shader, u.shininess, PHASE1.shininess);
+    up.set_bool(shader, u.useHalfLambert, PHASE1.use_half_lambert);
+    up.set_float(shader, u.sunDiffuseIntensity, sun_diffuse_intensity);
+    up.set_float(shader, u.sunSpecIntensity, sun_spec_intensity);
+    up.set_float(shader, u.pointDiffuseIntensity,
+                 PHASE1.point_diffuse_intensity);
 
     // Roof rectangles: disable direct sun indoors.
     // vec4(minX, minZ, maxX, maxZ)
-    const vec4 rects[] = {
-        {LOBBY_BUILDING.min().x, LOBBY_BUILDING.min().y, LOBBY_BUILDING.max().x,
-         LOBBY_BUILDING.max().y},
-        {MODEL_TEST_BUILDING.min().x, MODEL_TEST_BUILDING.min().y,
-         MODEL_TEST_BUILDING.max().x, MODEL_TEST_BUILDING.max().y},
-        {PROGRESSION_BUILDING.min().x, PROGRESSION_BUILDING.min().y,
-         PROGRESSION_BUILDING.max().x, PROGRESSION_BUILDING.max().y},
-        {STORE_BUILDING.min().x, STORE_BUILDING.min().y, STORE_BUILDING.max().x,
-         STORE_BUILDING.max().y},
-        {BAR_BUILDING.min().x, BAR_BUILDING.min().y, BAR_BUILDING.max().x,
-         BAR_BUILDING.max().y},
-        {LOAD_SAVE_BUILDING.min().x, LOAD_SAVE_BUILDING.min().y,
-         LOAD_SAVE_BUILDING.max().x, LOAD_SAVE_BUILDING.max().y},
+    static const std::array<vec4, lighting::NUM_BUILDINGS> roof_rects = {
+        building_rect_minmax(LOBBY_BUILDING),
+        building_rect_minmax(MODEL_TEST_BUILDING),
+        building_rect_minmax(PROGRESSION_BUILDING),
+        building_rect_minmax(STORE_BUILDING),
+        building_rect_minmax(BAR_BUILDING),
+        building_rect_minmax(LOAD_SAVE_BUILDING),
     };
-    const int count = 6;
-    set_int(shader, u.roofRectCount, count);
-    raylib::SetShaderValueV(shader, u.roofRects, rects,
-                            raylib::SHADER_UNIFORM_VEC4, count);
-
-    // Indoor point lights (always on, day + night).
-    if (!g_indoor_layout.initialized) {
-        rebuild_indoor_light_layout();
-    }
-
-    set_int(shader, u.lightsPerBuilding, IndoorLightLayout::kLightsPerBuilding);
-    set_int(shader, u.lightRectCount, IndoorLightLayout::kBuildings);
-    raylib::SetShaderValueV(
-        shader, u.lightRects, g_indoor_layout.light_rects.data(),
-        raylib::SHADER_UNIFORM_VEC4, IndoorLightLayout::kBuildings);
-
-    set_int(shader, u.pointLightCount, IndoorLightLayout::kTotalLights);
-    raylib::SetShaderValueV(shader, u.pointLightsPosRadius,
-                            g_indoor_layout.lights_pos_radius.data(),
-                            raylib::SHADER_UNIFORM_VEC4,
-                            IndoorLightLayout::kTotalLights);
-
-    // Lighting behavior tuning:
-    // At night, only BAR_BUILDING lights remain on; other buildings are closed.
-    constexpr int bar_building_index = 4;
-
-    std::array<vec3, IndoorLightLayout::kTotalLights> colors =
-        g_indoor_layout.lights_color;
-
-    // Daytime goal: make inside/outside feel similar in brightness.
-    // Boost only indoor point lights during the day (doesn't affect outdoors
-    // due to rect culling).
-    if (!is_night) {
-        constexpr float kDayIndoorBoost = 1.60f;
-        for (auto& c : colors) {
-            c = vec3{c.x * kDayIndoorBoost, c.y * kDayIndoorBoost,
-                     c.z * kDayIndoorBoost};
-        }
-    }
-
-    for (int b = 0; b < IndoorLightLayout::kBuildings; b++) {
-        const int base = b * IndoorLightLayout::kLightsPerBuilding;
-        const bool enabled = (!is_night) || (b == bar_building_index);
-
-        for (int i = 0; i < IndoorLightLayout::kLightsPerBuilding; i++) {
-            const int idx = base + i;
-            if (!enabled) {
-                colors[idx] = vec3{0.0f, 0.0f, 0.0f};
-            }
-        }
+    up.set_int(shader, u.roofRectCount, lighting::NUM_BUILDINGS);
+    up.set(shader, u.roofRects, roof_rects.data(), raylib::SHADER_UNIFORM_VEC4,
+           lighting::NUM_BUILDINGS);
+
+    // Indoor point lights (always on during the day, only the bar at night).
+    refresh_lights(is_night);
+    const lighting::LightList& lights = g_runtime.lights;
+
+    up.set_int(shader, u.lightRectCount, lights.rect_count);
+    up.set(shader, u.lightRects, lights.rects.data(),
+           raylib::SHADER_UNIFORM_VEC4, lights.rect_count);
+    up.set(shader, u.lightRanges, lights.ranges.data(),
+           raylib::SHADER_UNIFORM_IVEC2, lights.rect_count);
+
+    up.set_int(shader, u.pointLightCount, lights.light_count);
+    if (lights.light_count > 0) {
+        up.set(shader, u.pointLights, lights.packed.data(),
+               raylib::SHADER_UNIFORM_VEC4, lights.light_count * 2);
     }
-
-    raylib::SetShaderValueV(shader, u.pointLightsColor, colors.data(),
-                            raylib::SHADER_UNIFORM_VEC3,
-                            IndoorLightLayout::kTotalLights);
 }
@@ -1,7 +1,63 @@
 #pragma once
 
+#include <array>
+#include <vector>
+
 #include "engine/graphics.h"
 
 // Lighting runtime data + uniform updates for the scene lighting shader.
 void update_lighting_shader(raylib::Shader& shader,
                             const raylib::Camera3D& cam);
+
+namespace lighting {
+
+// Must match the array sizes in lighting.fs
+constexpr int MAX_LIGHT_RECTS = 8;
+constexpr int MAX_POINT_LIGHTS = 64;
+
+constexpr int NUM_BUILDINGS = 6;
+constexpr int BAR_BUILDING_INDEX = 4;
+constexpr int LIGHTS_PER_BUILDING = 10;
+// At night every other building is dark, so the bar gets their slots
+constexpr int NIGHT_BAR_LIGHTS = 20;
+
+static_assert(NUM_BUILDINGS <= MAX_LIGHT_RECTS);
+static_assert(NUM_BUILDINGS * LIGHTS_PER_BUILDING <= MAX_POINT_LIGHTS);
+static_assert(NIGHT_BAR_LIGHTS <= MAX_POINT_LIGHTS);
+
+// CPU side copy of the indoor lights, laid out exactly how the shader wants
+// them so the whole thing goes up in one SetShaderValueV per array.
+struct LightList {
+    int rect_count = 0;
+    // vec4(minX, minZ, maxX, maxZ)
+    std::array<vec4, MAX_LIGHT_RECTS> rects{};
+    // matches an ivec2 in the shader
+    struct Range {
+        int first = 0;
+        int count = 0;
+    };
+    std::array<Range, MAX_LIGHT_RECTS> ranges{};
+
+    int light_count = 0;
+    // two vec4 per light: (x, y, z, radius) then (r, g, b, unused)
+    std::array<vec4, MAX_POINT_LIGHTS * 2> packed{};
+
+    [[nodiscard]] vec4 pos_radius(int light) const {
+        return packed[light * 2];
+    }
+    [[nodiscard]] vec3 color(int light) const {
+        const vec4& c = packed[light * 2 + 1];
+        return vec3{c.x, c.y, c.z};
+    }
+};
+
+// Tight interior rect for the bar from its wall positions, falls back to the
+// building area when there are no walls (or they dont form a room)
+[[nodiscard]] vec4 bar_light_rect(const std::vector<vec2>& wall_positions);
+
+// Pure function of the inputs so it can run without a window,
+// the runtime only calls it when the bar walls or the time of day change
+[[nodiscard]] LightList gather_indoor_lights(const vec4& bar_rect,
+                                             bool is_night);
+
+}  // namespace lighting
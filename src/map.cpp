@@ -11,6 +11,9 @@
 //
 #include "entities/entity_helper.h"
 #include "system/core/system_manager.h"
+#include "system/rendering/render_culling.h"
+#include "system/rendering/static_geometry.h"
+#include "system/rendering/wall_set_tracker.h"
 
 void Map::update_map(const Map& new_map) {
     this->showMinimap = new_map.showMinimap;
@@ -55,9 +58,13 @@ void Map::_onUpdate(const std::vector<std::shared_ptr<Entity>>& players,
 
 void Map::onDraw(float dt) const {
     TRACY_ZONE_SCOPED;
+    system_manager::render_manager::start_culling_frame();
+    system_manager::render_manager::update_wall_set();
+
     // TODO :INFRA: merge this into normal render pipeline
     SystemManager::get().render_entities(remote_players_NOT_SERIALIZED, dt);
 
+    system_manager::render_manager::render_static_geometry();
     SystemManager::get().render_entities(EntityHelper::get_entities(), dt);
 }
 
@@ -16,6 +16,7 @@
 #include "../engine/path_request_manager.h"
 #include "../engine/random_engine.h"
 #include "../engine/thread_role.h"
+#include "../engine/tick_scheduler.h"
 #include "../engine/time.h"
 #include "../entities/entity_helper.h"
 #include "../globals.h"  // for HASHED_VERSION
@@ -180,35 +181,25 @@ void Server::run() {
     // should probably always be about / above whats in the game.h
     // TODO - should be a setting since on this computer i need it slow
     constexpr float desiredFrameRate = 120.0f;
-    constexpr std::chrono::duration<float> fixedTimeStep(1.0f /
-                                                         desiredFrameRate);
+    TickScheduler scheduler("server", desiredFrameRate);
 
-    // Initialize time variables
-    auto previousTime = std::chrono::high_resolution_clock::now();
-    auto currentTime = previousTime;
+#if MEASURE_SERVER_PERF
+    auto previousTime = std::chrono::steady_clock::now();
+#endif
 
     // Turn on pathfinding
     pathfinding_thread = PathRequestManager::start();
 
-    while (running) {
-        currentTime = std::chrono::high_resolution_clock::now();
-        float duration =
-            std::chrono::duration_cast<std::chrono::duration<float>>(
-                currentTime - previousTime)
-                .count();
+    scheduler.run_while(running, [&](float dt) {
+        tick(dt);
 
+#if MEASURE_SERVER_PERF
+        auto currentTime = std::chrono::steady_clock::now();
         size_t ms = std::chrono::duration_cast<std::chrono::milliseconds>(
                         currentTime - previousTime)
                         .count();
+        previousTime = currentTime;
 
-        if (duration >= fixedTimeStep.count()) {
-            tick(fixedTimeStep.count());
-
-            // Update previous time to keep track of the next tick
-            previousTime = currentTime;
-        }
-
-#if MEASURE_SERVER_PERF
         last_frames[last_frames_index] = ms;
         last_frames_index = (last_frames_index + 1);
         if (!has_looped && last_frames_index >= last_frames.size())
@@ -223,13 +214,7 @@ void Server::run() {
         avglf /= (has_looped ? last_frames.size() : last_frames_index);
         log_info("avg frame {:2}ms", avglf);
 #endif
-        // 240fps would be 4ms (well like 4.16ms)
-
-        // Sleep to control the frame rate
-        if (ms < 3) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
-        }
-    }
+    });
 }
 
 #if MEASURE_SERVER_PERF
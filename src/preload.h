@@ -19,6 +19,8 @@
 #include "libraries/texture_atlas.h"
 #include "libraries/texture_library.h"
 #include "resources/fonts/Karmina_Regular_256.h"
+#include "system/rendering/static_geometry.h"
+#include "text_mesh_cache.h"
 
 inline raylib::Font load_karmina_regular() {
     auto font = font::LoadFont_KarminaRegular256();
@@ -41,6 +43,8 @@ struct Preload {
             ext::close_audio_device();
         }
 
+        TextMeshCache::get().unload_all();
+        system_manager::render_manager::unload_static_geometry();
         TextureLibrary::get().unload_all();
         TextureAtlasLibrary::get().unload_all();
         afterhours::sound_system::MusicLibrary::get().unload_all();
@@ -1,6 +1,12 @@
 #include "world_snapshot_blob.h"
 
+#include <array>
 #include <bitset>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "../components/all_components.h"
 #include "../engine/log.h"
@@ -14,9 +20,77 @@ using Buffer = std::string;
 using OutArchive = zpp::bits::out<Buffer>;
 using InArchive = zpp::bits::in<const Buffer>;
 
+using ComponentPtr = std::remove_cvref_t<
+    decltype(std::declval<afterhours::Entity&>().componentArray[0])>;
+constexpr size_t kMaxComponentIds = std::tuple_size_v<std::remove_cvref_t<
+    decltype(std::declval<afterhours::Entity&>().componentArray)>>;
+
+// The client decodes a whole world every snapshot and used to throw the
+// previous one away, which is one Entity and a handful of components per
+// entity going through new/delete every time. Instead the old entities and
+// their component storage are kept around and reused by the next decode.
+//
+// Thread local since decode runs on whichever thread owns the collection.
+struct DecodePool {
+    // Entities from the previous decode, only reused once nothing else
+    // (queries, UI, refs) holds on to them
+    std::vector<std::shared_ptr<afterhours::Entity>> shells;
+    // Per component type free lists, indexed by afterhours component id
+    std::array<std::vector<ComponentPtr>, kMaxComponentIds> free_components;
+
+    DecodeAllocStats stats;
+
+    std::shared_ptr<afterhours::Entity> acquire_entity() {
+        while (!shells.empty()) {
+            std::shared_ptr<afterhours::Entity> sp = std::move(shells.back());
+            shells.pop_back();
+            if (!sp || sp.use_count() != 1) continue;
+            stats.entities_reused++;
+            return sp;
+        }
+        stats.entities_allocated++;
+        return std::make_shared<afterhours::Entity>();
+    }
+
+    void release_components(afterhours::Entity& e) {
+        for (size_t id = 0; id < e.componentArray.size(); id++) {
+            if (!e.componentArray[id]) continue;
+            free_components[id].push_back(std::move(e.componentArray[id]));
+        }
+        e.componentSet.reset();
+    }
+
+    template<typename T>
+    T& add_component(afterhours::Entity& e) {
+        const afterhours::ComponentID id =
+            afterhours::components::get_type_id<T>();
+        std::vector<ComponentPtr>& free = free_components[id];
+        if (free.empty()) {
+            stats.components_allocated++;
+            return e.addComponent<T>();
+        }
+
+        ComponentPtr ptr = std::move(free.back());
+        free.pop_back();
+        stats.components_reused++;
+
+        // Same id means same type, reset it in place rather than reallocate
+        T* cmp = static_cast<T*>(ptr.get());
+        cmp->~T();
+        new (cmp) T();
+        e.componentArray[id] = std::move(ptr);
+        e.componentSet[id] = true;
+        return *cmp;
+    }
+};
+
+DecodePool& decode_pool() {
+    thread_local DecodePool pool;
+    return pool;
+}
+
 inline void clear_all_components(afterhours::Entity& e) {
-    e.componentSet.reset();
-    for (auto& ptr : e.componentArray) ptr.reset();
+    decode_pool().release_components(e);
 }
 
 struct ComponentSerde {
@@ -38,7 +112,7 @@ std::errc serde_write(OutArchive& out, afterhours::Entity& e) {
 
 template<typename T>
 std::errc serde_read(InArchive& in, afterhours::Entity& e) {
-    auto& cmp = e.addComponent<T>();
+    auto& cmp = decode_pool().add_component<T>(e);
     return in(cmp);
 }
 
@@ -279,17 +353,29 @@ bool decode_into_current_world(const std::string& blob) {
         return false;
     }
 
+    DecodePool& pool = decode_pool();
+    pool.stats = DecodeAllocStats{};
+
     Entities new_entities;
     new_entities.reserve(num_entities);
     for (uint32_t i = 0; i < num_entities; ++i) {
-        std::shared_ptr<afterhours::Entity> sp(new afterhours::Entity());
+        std::shared_ptr<afterhours::Entity> sp = pool.acquire_entity();
         if (zpp::bits::failure(read_entity(in, *sp))) return false;
         new_entities.push_back(std::move(sp));
     }
 
+    // Hold on to the world we are replacing so its entities become the shells
+    // for the next decode
+    Entities previous = EntityHelper::get_entities();
     EntityHelper::get_current_collection().replace_all_entities(
         std::move(new_entities));
+    EntityHelper::prunePendingIndex();
+    EntityHelper::invalidateSlots();
+    EntityHelper::invalidateReferences();
+    pool.shells = std::move(previous);
     return true;
 }
 
+DecodeAllocStats last_decode_alloc_stats() { return decode_pool().stats; }
+
 }  // namespace snapshot_blob
@@ -24,6 +24,16 @@ constexpr std::uint32_t MaxEntitySnapshotBytes = 2u * 1024u * 1024u;  // 2 MiB
 // Returns false on decode errors.
 [[nodiscard]] bool decode_into_current_world(const std::string& blob);
 
+// How much of the last decode_into_current_world on this thread came out of
+// the reuse pool versus new allocations.
+struct DecodeAllocStats {
+    std::uint32_t entities_allocated = 0;
+    std::uint32_t entities_reused = 0;
+    std::uint32_t components_allocated = 0;
+    std::uint32_t components_reused = 0;
+};
+[[nodiscard]] DecodeAllocStats last_decode_alloc_stats();
+
 // Serialize just one entity into a byte blob (used by unit tests).
 [[nodiscard]] std::string encode_entity(const afterhours::Entity& entity);
 
@@ -1,5 +1,6 @@
 // System includes - each system is in its own header file to improve build
 // times
+#include "../core/system_groups.h"
 #include "day_night_transition/bypass_init_system.h"
 #include "day_night_transition/clean_up_old_store_options_system.h"
 #include "day_night_transition/delete_floating_items_when_leaving_in_round_system.h"
@@ -11,23 +12,20 @@
 namespace system_manager {}  // namespace system_manager
 
 void SystemManager::register_day_night_transition_systems() {
-    // Day/night transition systems - all check needs_to_process_change in
-    // should_run(), reset clears the flag after processing
+    // Day/night transition systems - the group only runs while
+    // needs_to_process_change is set, reset clears the flag after processing
+    system_groups::GroupRegistrar group(systems,
+                                        SystemGroup::DayNightTransition);
     {
 #if ENABLE_DEV_FLAGS
-        systems.register_update_system(
-            std::make_unique<system_manager::BypassInitSystem>());
+        group.add<system_manager::BypassInitSystem>();
 #endif
         // Day start systems
         {
-            systems.register_update_system(
-                std::make_unique<system_manager::GenerateStoreOptionsSystem>());
-            systems.register_update_system(
-                std::make_unique<system_manager::OpenStoreDoorsSystem>());
-            systems.register_update_system(
-                std::make_unique<
-                    system_manager::
-                        DeleteFloatingItemsWhenLeavingInRoundSystem>());
+            group.add<system_manager::GenerateStoreOptionsSystem>();
+            group.add<system_manager::OpenStoreDoorsSystem>();
+            group.add<
+                system_manager::DeleteFloatingItemsWhenLeavingInRoundSystem>();
             // TODO: Add remaining systems when their headers are created
             // systems.register_update_system(
             //     std::make_unique<system_manager::TellCustomersToLeaveSystem>());
@@ -44,14 +42,11 @@ void SystemManager::register_day_night_transition_systems() {
             // systems.register_update_system(
             //     std::make_unique<system_manager::OnRoundFinishedTriggerSystem>());
 #if ENABLE_DEV_FLAGS
-            systems.register_update_system(
-                std::make_unique<system_manager::BypassInitSystem>());
+            group.add<system_manager::BypassInitSystem>();
 #endif
         }
-        systems.register_update_system(
-            std::make_unique<system_manager::CleanUpOldStoreOptionsSystem>());
-        systems.register_update_system(
-            std::make_unique<system_manager::OnDayEndedSystem>());
+        group.add<system_manager::CleanUpOldStoreOptionsSystem>();
+        group.add<system_manager::OnDayEndedSystem>();
         // TODO: Add remaining systems when their headers are created
         // systems.register_update_system(
         //     std::make_unique<system_manager::ResetRegisterQueueWhenLeavingInRoundSystem>());
@@ -65,6 +60,5 @@ void SystemManager::register_day_night_transition_systems() {
         //     std::make_unique<system_manager::DeleteTrashWhenLeavingPlanningSystem>());
     }
     // This one needs to run after the transition systems to clear the flag
-    systems.register_update_system(
-        std::make_unique<system_manager::ResetHasDayNightChanged>());
+    group.add<system_manager::ResetHasDayNightChanged>();
 }
@@ -1,6 +1,7 @@
 // System includes - each system is in its own header file to improve build
 // times
 #include "../ai/ai_system.h"
+#include "../core/system_groups.h"
 #include "../ai/ai_transition_systems.h"
 #include "../ai/process_ai_system.h"
 #include "gamelike/end_of_round_completion_validation_system.h"
@@ -12,25 +13,24 @@
 namespace system_manager {}  // namespace system_manager
 
 void SystemManager::register_gamelike_systems() {
-    systems.register_update_system(
-        std::make_unique<system_manager::RunTimerSystem>());
-    systems.register_update_system(
-        std::make_unique<system_manager::ProcessPnumaticPipePairingSystem>());
-    systems.register_update_system(
-        std::make_unique<
-            system_manager::ProcessIsContainerAndShouldBackfillItemSystem>());
-    systems.register_update_system(
-        std::make_unique<
-            system_manager::PassTimeForTransactionAnimationSystem>());
+    system_groups::GroupRegistrar group(systems, SystemGroup::GameLike);
+    group.add<system_manager::RunTimerSystem>();
+    group.add_parallel<system_manager::ProcessPnumaticPipePairingSystem,
+                       system_manager::PassTimeForTransactionAnimationSystem>();
+    group.add<system_manager::ProcessIsContainerAndShouldBackfillItemSystem>();
 
     // AI systems: setup -> state processing -> commit
-    system_manager::register_ai_transition_systems(systems);
-    system_manager::register_ai_systems(systems);
-    system_manager::register_ai_transition_commit_systems(systems);
+    group.add_timed("ai_transition_systems", [&]() {
+        system_manager::register_ai_transition_systems(systems);
+    });
+    group.add_timed("ai_systems", [&]() {
+        system_manager::register_ai_systems(systems);
+    });
+    group.add_timed("ai_transition_commit_systems", [&]() {
+        system_manager::register_ai_transition_commit_systems(systems);
+    });
 
-    systems.register_update_system(
-        std::make_unique<
-            system_manager::EndOfRoundCompletionValidationSystem>());
+    group.add<system_manager::EndOfRoundCompletionValidationSystem>();
 
     register_day_night_transition_systems();
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 // System includes - each system is in its own header file to improve build
 // times
+#include "../core/system_groups.h"
 #include "../input/input_process_manager.h"
 #include "inround/process_conveyer_items_system.h"
 #include "inround/process_grabber_filter_system.h"
@@ -14,34 +15,24 @@
 #include "inround/upgrade_in_round_update_system.h"
 
 void SystemManager::register_inround_systems() {
-    systems.register_update_system(
-        std::make_unique<
-            system_manager::ResetCustomersThatNeedResettingSystem>());
-    systems.register_update_system(
-        std::make_unique<system_manager::ProcessGrabberItemsSystem>());
-    systems.register_update_system(
-        std::make_unique<system_manager::ProcessConveyerItemsSystem>());
-    systems.register_update_system(
-        std::make_unique<system_manager::ProcessGrabberFilterSystem>());
-    systems.register_update_system(
-        std::make_unique<system_manager::ProcessHasRopeSystem>());
-    systems.register_update_system(
-        std::make_unique<system_manager::ProcessPnumaticPipeMovementSystem>());
+    system_groups::GroupRegistrar group(systems, SystemGroup::InRound);
+    group.add<system_manager::ResetCustomersThatNeedResettingSystem>();
+    group.add<system_manager::ProcessGrabberItemsSystem>();
+    group.add<system_manager::ProcessConveyerItemsSystem>();
+    group.add<system_manager::ProcessGrabberFilterSystem>();
+    group.add<system_manager::ProcessHasRopeSystem>();
+    group.add_parallel<system_manager::ProcessPnumaticPipeMovementSystem,
+                       system_manager::ReduceImpatientCustomersSystem>();
     // should move all the container functions into its own
     // function?
-    systems.register_update_system(
-        std::make_unique<
-            system_manager::ProcessIsContainerAndShouldUpdateItemSystem>());
+    group.add<system_manager::ProcessIsContainerAndShouldUpdateItemSystem>();
     // This one should be after the other container ones
-    systems.register_update_system(
-        std::make_unique<
-            system_manager::
-                ProcessIsIndexedContainerHoldingIncorrectItemSystem>());
+    group.add<
+        system_manager::ProcessIsIndexedContainerHoldingIncorrectItemSystem>();
 
-    systems.register_update_system(
-        std::make_unique<system_manager::ProcessSpawnerSystem>());
-    systems.register_update_system(
-        std::make_unique<system_manager::ReduceImpatientCustomersSystem>());
-    system_manager::input_process_manager::inround::register_input_systems(
-        systems);
+    group.add<system_manager::ProcessSpawnerSystem>();
+    group.add_timed("inround_input_systems", [&]() {
+        system_manager::input_process_manager::inround::register_input_systems(
+            systems);
+    });
 }
\ No newline at end of file
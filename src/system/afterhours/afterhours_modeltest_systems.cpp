@@ -1,3 +1,4 @@
+#include "../core/system_groups.h"
 #include "../core/system_manager.h"
 
 // Component includes needed for the moved struct definitions
@@ -14,6 +15,7 @@
 #include "../../entities/entity_helper.h"
 #include "../../entities/entity_id.h"
 #include "../../entities/entity_type.h"
+#include "../../entities/singleton_component.h"
 
 namespace system_manager {
 
@@ -48,15 +50,11 @@ struct ProcessIsContainerAndShouldBackfillItemSystem
         if (GameState::get().is(game::State::ModelTest)) return true;
 
         if (!GameState::get().is_game_like()) return false;
-        try {
-            Entity& sophie = EntityHelper::getNamedEntity(NamedEntity::Sophie);
-            const HasDayNightTimer& timer = sophie.get<HasDayNightTimer>();
-            // Skip during transitions to avoid creating hundreds of items
-            // before transition logic completes
-            return !timer.needs_to_process_change;
-        } catch (...) {
-            return true;
-        }
+        const auto* timer = Singleton<HasDayNightTimer>::get_ptr();
+        if (!timer) return true;
+        // Skip during transitions to avoid creating hundreds of items
+        // before transition logic completes
+        return !timer->needs_to_process_change;
     }
 
     virtual void for_each_with(Entity& entity, IsItemContainer& iic,
@@ -107,16 +105,12 @@ struct ProcessIsContainerAndShouldUpdateItemSystem
         if (GameState::get().is(game::State::ModelTest)) return true;
 
         if (!GameState::get().is_game_like()) return false;
-        try {
-            Entity& sophie = EntityHelper::getNamedEntity(NamedEntity::Sophie);
-            const HasDayNightTimer& hastimer = sophie.get<HasDayNightTimer>();
-            // Don't run during transitions to avoid spawners creating entities
-            // before transition logic completes
-            if (hastimer.needs_to_process_change) return false;
-            return hastimer.is_bar_closed();
-        } catch (...) {
-            return false;
-        }
+        const auto* hastimer = Singleton<HasDayNightTimer>::get_ptr();
+        if (!hastimer) return false;
+        // Don't run during transitions to avoid spawners creating entities
+        // before transition logic completes
+        if (hastimer->needs_to_process_change) return false;
+        return hastimer->is_bar_closed();
     }
 
     virtual void for_each_with(Entity& entity, Transform& transform,
@@ -148,16 +142,12 @@ struct ProcessIsIndexedContainerHoldingIncorrectItemSystem
         if (GameState::get().is(game::State::ModelTest)) return true;
 
         if (!GameState::get().is_game_like()) return false;
-        try {
-            Entity& sophie = EntityHelper::getNamedEntity(NamedEntity::Sophie);
-            const HasDayNightTimer& hastimer = sophie.get<HasDayNightTimer>();
-            // Don't run during transitions to avoid spawners creating entities
-            // before transition logic completes
-            if (hastimer.needs_to_process_change) return false;
-            return hastimer.is_bar_closed();
-        } catch (...) {
-            return false;
-        }
+        const auto* hastimer = Singleton<HasDayNightTimer>::get_ptr();
+        if (!hastimer) return false;
+        // Don't run during transitions to avoid spawners creating entities
+        // before transition logic completes
+        if (hastimer->needs_to_process_change) return false;
+        return hastimer->is_bar_closed();
     }
 
     virtual void for_each_with(Entity&, Indexer& indexer, CanHoldItem& canHold,
@@ -189,20 +179,15 @@ struct ProcessIsIndexedContainerHoldingIncorrectItemSystem
 
 // Model test update system - processes entities during model test state
 void SystemManager::register_modeltest_systems() {
+    system_groups::GroupRegistrar group(systems, SystemGroup::ModelTest);
     // should move all the container functions into its own
     // function?
-    systems.register_update_system(
-        std::make_unique<
-            system_manager::ProcessIsContainerAndShouldUpdateItemSystem>());
+    group.add<system_manager::ProcessIsContainerAndShouldUpdateItemSystem>();
     // This one should be after the other container ones
     // TODO before you migrate this, we need to look at the should_run logic
     // since the existing System<> uses is_bar_closed
-    systems.register_update_system(
-        std::make_unique<
-            system_manager::
-                ProcessIsIndexedContainerHoldingIncorrectItemSystem>());
-
-    systems.register_update_system(
-        std::make_unique<
-            system_manager::ProcessIsContainerAndShouldBackfillItemSystem>());
+    group.add<
+        system_manager::ProcessIsIndexedContainerHoldingIncorrectItemSystem>();
+
+    group.add<system_manager::ProcessIsContainerAndShouldBackfillItemSystem>();
 }
@@ -1,7 +1,11 @@
+#include "../core/system_groups.h"
 #include "../core/system_manager.h"
 #include "../input/input_process_manager.h"
 
 void SystemManager::register_planning_systems() {
-    system_manager::input_process_manager::planning::register_input_systems(
-        systems);
+    system_groups::GroupRegistrar group(systems, SystemGroup::Planning);
+    group.add_timed("planning_input_systems", [&]() {
+        system_manager::input_process_manager::planning::register_input_systems(
+            systems);
+    });
 }
@@ -4,6 +4,7 @@
 #include "../../../components/bypass_automation_state.h"
 #include "../../../components/has_day_night_timer.h"
 #include "../../../entities/entity_helper.h"
+#include "../../../entities/singleton_component.h"
 #include "../../core/system_manager.h"
 
 namespace system_manager {
@@ -11,13 +12,10 @@ namespace system_manager {
 struct BypassInitSystem : public afterhours::System<BypassAutomationState> {
     virtual bool should_run(const float) override {
         if (!BYPASS_MENU && BYPASS_ROUNDS <= 0) return false;
-        try {
-            Entity& sophie = EntityHelper::getNamedEntity(NamedEntity::Sophie);
-            sophie.addComponentIfMissing<BypassAutomationState>();
-            return true;
-        } catch (...) {
-            return false;
-        }
+        OptEntity sophie = Singleton<HasDayNightTimer>::entity();
+        if (!sophie) return false;
+        sophie.asE().addComponentIfMissing<BypassAutomationState>();
+        return true;
     }
 
     virtual void for_each_with(Entity&, BypassAutomationState& state,
@@ -7,20 +7,18 @@
 #include "../../../engine/statemanager.h"
 #include "../../../entities/entity_helper.h"
 #include "../../../entities/entity_query.h"
+#include "../../../entities/singleton_component.h"
+#include "../../core/system_groups.h"
 #include "../../core/system_manager.h"
 
 namespace system_manager {
 
 struct CleanUpOldStoreOptionsSystem : public afterhours::System<> {
     virtual bool should_run(const float) override {
-        if (!GameState::get().is_game_like()) return false;
-        try {
-            Entity& sophie = EntityHelper::getNamedEntity(NamedEntity::Sophie);
-            const HasDayNightTimer& timer = sophie.get<HasDayNightTimer>();
-            return timer.needs_to_process_change && timer.is_bar_closed();
-        } catch (...) {
+        if (!system_groups::is_active(SystemGroup::DayNightTransition))
             return false;
-        }
+        const auto* timer = Singleton<HasDayNightTimer>::get_ptr();
+        return timer && timer->is_bar_closed();
     }
     virtual void once(float) override {
         OptEntity cart_area =
@@ -7,6 +7,8 @@
 #include "../../../components/is_item_container.h"
 #include "../../../engine/statemanager.h"
 #include "../../../entities/entity_helper.h"
+#include "../../../entities/singleton_component.h"
+#include "../../core/system_groups.h"
 #include "../../core/system_manager.h"
 
 namespace system_manager {
@@ -14,14 +16,10 @@ namespace system_manager {
 struct DeleteFloatingItemsWhenLeavingInRoundSystem
     : public afterhours::System<IsItem> {
     virtual bool should_run(const float) override {
-        if (!GameState::get().is_game_like()) return false;
-        try {
-            Entity& sophie = EntityHelper::getNamedEntity(NamedEntity::Sophie);
-            const HasDayNightTimer& timer = sophie.get<HasDayNightTimer>();
-            return timer.needs_to_process_change && timer.is_bar_closed();
-        } catch (...) {
+        if (!system_groups::is_active(SystemGroup::DayNightTransition))
             return false;
-        }
+        const auto* timer = Singleton<HasDayNightTimer>::get_ptr();
+        return timer && timer->is_bar_closed();
     }
 
     virtual void for_each_with(Entity& entity, IsItem& ii, float) override {
@@ -14,21 +14,19 @@
 #include "../../../entities/entity_makers.h"
 #include "../../../entities/entity_query.h"
 #include "../../../entities/entity_type.h"
+#include "../../../entities/singleton_component.h"
 #include "../../../libraries/config_key_library.h"
+#include "../../core/system_groups.h"
 #include "../../core/system_manager.h"
 
 namespace system_manager {
 
 struct GenerateStoreOptionsSystem : public afterhours::System<> {
     virtual bool should_run(const float) override {
-        if (!GameState::get().is_game_like()) return false;
-        try {
-            Entity& sophie = EntityHelper::getNamedEntity(NamedEntity::Sophie);
-            const HasDayNightTimer& timer = sophie.get<HasDayNightTimer>();
-            return timer.needs_to_process_change && timer.is_bar_closed();
-        } catch (...) {
+        if (!system_groups::is_active(SystemGroup::DayNightTransition))
             return false;
-        }
+        const auto* timer = Singleton<HasDayNightTimer>::get_ptr();
+        return timer && timer->is_bar_closed();
     }
     virtual void once(float) override {
         // Figure out what kinds of things we can spawn generally
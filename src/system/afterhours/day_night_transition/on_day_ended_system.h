@@ -5,20 +5,18 @@
 #include "../../../components/responds_to_day_night.h"
 #include "../../../engine/statemanager.h"
 #include "../../../entities/entity_helper.h"
+#include "../../../entities/singleton_component.h"
+#include "../../core/system_groups.h"
 #include "../../core/system_manager.h"
 
 namespace system_manager {
 
 struct OnDayEndedSystem : public afterhours::System<RespondsToDayNight> {
     virtual bool should_run(const float) override {
-        if (!GameState::get().is_game_like()) return false;
-        try {
-            Entity& sophie = EntityHelper::getNamedEntity(NamedEntity::Sophie);
-            const HasDayNightTimer& timer = sophie.get<HasDayNightTimer>();
-            return timer.needs_to_process_change && timer.is_bar_open();
-        } catch (...) {
+        if (!system_groups::is_active(SystemGroup::DayNightTransition))
             return false;
-        }
+        const auto* timer = Singleton<HasDayNightTimer>::get_ptr();
+        return timer && timer->is_bar_open();
     }
 
     virtual void for_each_with(Entity&, RespondsToDayNight& rtdn,
@@ -6,6 +6,8 @@
 #include "../../../components/is_solid.h"
 #include "../../../engine/statemanager.h"
 #include "../../../entities/entity_helper.h"
+#include "../../../entities/singleton_component.h"
+#include "../../core/system_groups.h"
 #include "../../core/system_manager.h"
 
 namespace system_manager {
@@ -14,14 +16,10 @@ struct OpenStoreDoorsSystem
     : public afterhours::System<IsSolid,
                                 afterhours::tags::All<EntityType::Door>> {
     virtual bool should_run(const float) override {
-        if (!GameState::get().is_game_like()) return false;
-        try {
-            Entity& sophie = EntityHelper::getNamedEntity(NamedEntity::Sophie);
-            const HasDayNightTimer& timer = sophie.get<HasDayNightTimer>();
-            return timer.needs_to_process_change && timer.is_bar_closed();
-        } catch (...) {
+        if (!system_groups::is_active(SystemGroup::DayNightTransition))
             return false;
-        }
+        const auto* timer = Singleton<HasDayNightTimer>::get_ptr();
+        return timer && timer->is_bar_closed();
     }
     virtual void for_each_with(Entity& entity, IsSolid&, float) override {
         if (!CheckCollisionBoxes(entity.get<Transform>().bounds(),
@@ -4,6 +4,7 @@
 #include "../../../components/has_day_night_timer.h"
 #include "../../../engine/statemanager.h"
 #include "../../../entities/entity_helper.h"
+#include "../../core/system_groups.h"
 #include "../../core/system_manager.h"
 
 namespace system_manager {
@@ -12,15 +13,8 @@ namespace system_manager {
 // systems have run
 struct ResetHasDayNightChanged : public afterhours::System<HasDayNightTimer> {
     virtual bool should_run(const float) override {
-        if (!GameState::get().is_game_like()) return false;
-        try {
-            Entity& sophie = EntityHelper::getNamedEntity(NamedEntity::Sophie);
-            const HasDayNightTimer& timer = sophie.get<HasDayNightTimer>();
-            // Only run when the flag is set (meaning transition systems ran)
-            return timer.needs_to_process_change;
-        } catch (...) {
-            return false;
-        }
+        // Only run when the flag is set (meaning transition systems ran)
+        return system_groups::is_active(SystemGroup::DayNightTransition);
     }
 
     virtual void for_each_with(Entity&, HasDayNightTimer& timer,
@@ -6,6 +6,7 @@
 #include "../../../engine/runtime_globals.h"
 #include "../../../engine/statemanager.h"
 #include "../../../globals.h"
+#include "../../core/system_groups.h"
 #include "../../core/system_manager.h"
 
 namespace system_manager {
@@ -26,7 +27,7 @@ struct EndOfRoundCompletionValidationSystem
     : public afterhours::System<HasDayNightTimer, CollectsCustomerFeedback,
                                 afterhours::tags::All<EntityType::Sophie>> {
     virtual bool should_run(const float) override {
-        return GameState::get().is_game_like();
+        return system_groups::is_active(SystemGroup::GameLike);
     }
 
     virtual void for_each_with(Entity& entity, HasDayNightTimer& ht,
@@ -3,15 +3,19 @@
 #include "../../../ah.h"
 #include "../../../components/is_bank.h"
 #include "../../../engine/statemanager.h"
+#include "../../core/system_groups.h"
+#include "../../core/system_scheduler.h"
 
 namespace system_manager {
 
 struct PassTimeForTransactionAnimationSystem
     : public afterhours::System<IsBank> {
     virtual bool should_run(const float) override {
-        return GameState::get().is_game_like();
+        return system_groups::is_active(SystemGroup::GameLike);
     }
 
+    static SystemAccess access() { return SystemAccess{}.writes<IsBank>(); }
+
     virtual void for_each_with(Entity&, IsBank& bank, float dt) override {
         std::vector<IsBank::Transaction>& transactions =
             bank.get_transactions();
@@ -11,6 +11,8 @@
 #include "../../../engine/statemanager.h"
 #include "../../../entities/entity.h"
 #include "../../../entities/entity_helper.h"
+#include "../../../entities/singleton_component.h"
+#include "../../core/system_groups.h"
 #include "../../core/system_manager.h"
 
 namespace system_manager {
@@ -26,16 +28,12 @@ struct ProcessIsContainerAndShouldBackfillItemSystem
     virtual ~ProcessIsContainerAndShouldBackfillItemSystem() = default;
 
     virtual bool should_run(const float) override {
-        if (!GameState::get().is_game_like()) return false;
-        try {
-            Entity& sophie = EntityHelper::getNamedEntity(NamedEntity::Sophie);
-            const HasDayNightTimer& timer = sophie.get<HasDayNightTimer>();
-            // Skip during transitions to avoid creating hundreds of items
-            // before transition logic completes
-            return !timer.needs_to_process_change;
-        } catch (...) {
-            return true;
-        }
+        if (!system_groups::is_active(SystemGroup::GameLike)) return false;
+        const auto* timer = Singleton<HasDayNightTimer>::get_ptr();
+        if (!timer) return true;
+        // Skip during transitions to avoid creating hundreds of items
+        // before transition logic completes
+        return !timer->needs_to_process_change;
     }
 
     virtual void for_each_with(Entity& entity, IsItemContainer& container,
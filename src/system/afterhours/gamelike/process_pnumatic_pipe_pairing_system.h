@@ -4,13 +4,20 @@
 #include "../../../components/is_pnumatic_pipe.h"
 #include "../../../engine/statemanager.h"
 #include "../../../entities/entity_query.h"
+#include "../../core/system_groups.h"
+#include "../../core/system_scheduler.h"
 
 namespace system_manager {
 
 struct ProcessPnumaticPipePairingSystem
     : public afterhours::System<IsPnumaticPipe> {
     virtual bool should_run(const float) override {
-        return GameState::get().is_game_like();
+        return system_groups::is_active(SystemGroup::GameLike);
+    }
+
+    // Writes the other pipe too, so not chunkable
+    static SystemAccess access() {
+        return SystemAccess{}.writes<IsPnumaticPipe>();
     }
 
     virtual void for_each_with(Entity& entity, IsPnumaticPipe& ipp,
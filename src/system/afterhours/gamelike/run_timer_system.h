@@ -6,6 +6,7 @@
 #include "../../../components/is_progression_manager.h"
 #include "../../../engine/statemanager.h"
 #include "../../../entities/entity_helper.h"
+#include "../../core/system_groups.h"
 #include "../../core/system_manager.h"
 #include "../../helpers/progression.h"
 
@@ -13,7 +14,7 @@ namespace system_manager {
 
 struct RunTimerSystem : public afterhours::System<HasDayNightTimer> {
     virtual bool should_run(const float) override {
-        return GameState::get().is_game_like();
+        return system_groups::is_active(SystemGroup::GameLike);
     }
 
     void execute_close_bar(Entity& entity, HasDayNightTimer& ht) {
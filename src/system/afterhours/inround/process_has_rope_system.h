@@ -7,10 +7,12 @@
 #include "../../../components/is_item.h"
 #include "../../../components/is_solid.h"
 #include "../../../engine/pathfinder.h"
+#include "../../../engine/scratch_arena.h"
 #include "../../../engine/statemanager.h"
 #include "../../../entities/entity_helper.h"
 #include "../../../entities/entity_type.h"
 #include "../../../vec_util.h"
+#include "../../core/system_groups.h"
 #include "../../core/system_manager.h"
 
 namespace system_manager {
@@ -20,17 +22,9 @@ struct ProcessHasRopeSystem
     virtual ~ProcessHasRopeSystem() = default;
 
     virtual bool should_run(const float) override {
-        if (!GameState::get().is_game_like()) return false;
-        try {
-            Entity& sophie = EntityHelper::getNamedEntity(NamedEntity::Sophie);
-            const HasDayNightTimer& hastimer = sophie.get<HasDayNightTimer>();
-            // Don't run during transitions to avoid spawners creating entities
-            // before transition logic completes
-            if (hastimer.needs_to_process_change) return false;
-            return hastimer.is_bar_open();
-        } catch (...) {
-            return false;
-        }
+        // Skipped during transitions to avoid spawners creating entities
+        // before transition logic completes
+        return system_groups::is_active(SystemGroup::InRound);
     }
 
     virtual void for_each_with(Entity& entity, CanHoldItem& chi,
@@ -74,7 +68,8 @@ struct ProcessHasRopeSystem
         auto new_path = pathfinder::find_path(entity.get<Transform>().as2(),
                                               pos, [](vec2) { return true; });
 
-        std::vector<vec2> extended_path;
+        scratch::Vector<vec2> extended_path = scratch::vector<vec2>();
+        extended_path.reserve(new_path.size() * 4);
         std::optional<vec2> prev;
         for (auto p : new_path) {
             if (prev.has_value()) {
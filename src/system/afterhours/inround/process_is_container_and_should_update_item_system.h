@@ -8,6 +8,7 @@
 #include "../../../components/transform.h"
 #include "../../../engine/statemanager.h"
 #include "../../../entities/entity_helper.h"
+#include "../../core/system_groups.h"
 #include "../../core/system_manager.h"
 
 namespace system_manager {
@@ -20,17 +21,9 @@ struct ProcessIsContainerAndShouldUpdateItemSystem
     virtual ~ProcessIsContainerAndShouldUpdateItemSystem() = default;
 
     virtual bool should_run(const float) override {
-        if (!GameState::get().is_game_like()) return false;
-        try {
-            Entity& sophie = EntityHelper::getNamedEntity(NamedEntity::Sophie);
-            const HasDayNightTimer& hastimer = sophie.get<HasDayNightTimer>();
-            // Don't run during transitions to avoid spawners creating entities
-            // before transition logic completes
-            if (hastimer.needs_to_process_change) return false;
-            return hastimer.is_bar_open();
-        } catch (...) {
-            return false;
-        }
+        // Skipped during transitions to avoid spawners creating entities
+        // before transition logic completes
+        return system_groups::is_active(SystemGroup::InRound);
     }
 
     virtual void for_each_with(Entity& entity, Transform& transform,
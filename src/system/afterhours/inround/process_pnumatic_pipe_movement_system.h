@@ -7,7 +7,9 @@
 #include "../../../engine/statemanager.h"
 #include "../../../entities/entity_helper.h"
 #include "../../../entities/entity_query.h"
+#include "../../core/system_groups.h"
 #include "../../core/system_manager.h"
+#include "../../core/system_scheduler.h"
 
 namespace system_manager {
 
@@ -17,17 +19,14 @@ struct ProcessPnumaticPipeMovementSystem
     virtual ~ProcessPnumaticPipeMovementSystem() = default;
 
     virtual bool should_run(const float) override {
-        if (!GameState::get().is_game_like()) return false;
-        try {
-            Entity& sophie = EntityHelper::getNamedEntity(NamedEntity::Sophie);
-            const HasDayNightTimer& hastimer = sophie.get<HasDayNightTimer>();
-            // Don't run during transitions to avoid spawners creating entities
-            // before transition logic completes
-            if (hastimer.needs_to_process_change) return false;
-            return hastimer.is_bar_open();
-        } catch (...) {
-            return false;
-        }
+        // Skipped during transitions to avoid spawners creating entities
+        // before transition logic completes
+        return system_groups::is_active(SystemGroup::InRound);
+    }
+
+    // Moves items between the two pipes of a pair, so not chunkable
+    static SystemAccess access() {
+        return SystemAccess{}.writes<IsPnumaticPipe, CanHoldItem, IsItem>();
     }
 
     virtual void for_each_with(Entity& entity, IsPnumaticPipe& ipp,
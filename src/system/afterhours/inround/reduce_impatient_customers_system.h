@@ -1,12 +1,16 @@
 #pragma once
 
+#include <optional>
+
 #include "../../../ah.h"
 #include "../../../components/has_day_night_timer.h"
 #include "../../../components/has_patience.h"
 #include "../../../engine/statemanager.h"
 #include "../../../entities/entity_helper.h"
 #include "../../../log/log.h"
+#include "../../core/system_groups.h"
 #include "../../core/system_manager.h"
+#include "../../core/system_scheduler.h"
 
 namespace system_manager {
 
@@ -16,24 +20,36 @@ struct ReduceImpatientCustomersSystem
     virtual ~ReduceImpatientCustomersSystem() = default;
 
     virtual bool should_run(const float) override {
-        if (!GameState::get().is_game_like()) return false;
-        try {
-            Entity& sophie = EntityHelper::getNamedEntity(NamedEntity::Sophie);
-            const HasDayNightTimer& hastimer = sophie.get<HasDayNightTimer>();
-            // Don't run during transitions to avoid spawners creating entities
-            // before transition logic completes
-            if (hastimer.needs_to_process_change) return false;
-            return hastimer.is_bar_open();
-        } catch (...) {
-            return false;
-        }
+        // Skipped during transitions to avoid spawners creating entities
+        // before transition logic completes
+        return system_groups::is_active(SystemGroup::InRound);
+    }
+
+    // Every customer only touches its own patience
+    static SystemAccess access() {
+        return SystemAccess{}.writes<HasPatience>().chunked();
     }
 
-    virtual void for_each_with(Entity&, HasPatience& patience,
+    // Far enough from running out that nobody needs to see it every tick.
+    // Has to stay well above SimLODInfo::REDUCED_INTERVAL ticks so the
+    // customer is back at full rate before patience can reach zero
+    static constexpr float FULL_RATE_BELOW_S = 1.f;
+
+    virtual void for_each_with(Entity& entity, HasPatience& patience,
                                float dt) override {
         if (!patience.should_pass_time()) return;
 
-        patience.pass_time(dt);
+        // The skipped ticks are handed over on the next run, so the total
+        // time taken off is the same as ticking every frame
+        if (patience.amount_left() > FULL_RATE_BELOW_S) {
+            patience.lod.reduce(entity.id);
+        } else {
+            patience.lod.promote();
+        }
+        std::optional<float> sim_dt = patience.lod.step(dt);
+        if (!sim_dt) return;
+
+        patience.pass_time(sim_dt.value());
 
         if (patience.pct() > 0) return;
 
@@ -14,8 +14,11 @@
 #include "../../entities/entity_makers.h"
 #include "../../entities/entity_query.h"
 #include "../../entities/entity_type.h"
+#include "../../entities/singleton_component.h"
+#include "ai_decision_scheduler.h"
 #include "ai_entity_helpers.h"
 #include "ai_shared_utilities.h"
+#include "ai_system.h"
 #include "ai_tags.h"
 #include "ai_targeting.h"
 
@@ -31,18 +34,7 @@ struct AIBathroomSystem
     }
 
     OptEntity find_best_toilet(Entity& entity) {
-        return EntityQuery()
-            .whereHasComponent<IsToilet>()
-            .whereHasComponent<HasWaitingQueue>()
-            .whereLambda([](const Entity& e) {
-                return !e.get<HasWaitingQueue>().is_full();
-            })
-            .whereCanPathfindTo(entity.get<Transform>().as2())
-            .orderByLambda([](const Entity& r1, const Entity& r2) {
-                return r1.get<HasWaitingQueue>().get_next_pos() <
-                       r2.get<HasWaitingQueue>().get_next_pos();
-            })
-            .gen_first();
+        return system_manager::ai::blackboard().best_toilet(entity);
     }
 
     void for_each_with(Entity& entity, IsAIControlled& ctrl,
@@ -70,7 +62,10 @@ struct AIBathroomSystem
         HasAIBathroomState& bs = entity.get<HasAIBathroomState>();
         HasAITargetEntity& tgt = entity.get<HasAITargetEntity>();
 
-        if (!system_manager::ai::entity_ref_valid(tgt.entity)) {
+        if (!system_manager::ai::line_target_valid(tgt.entity, entity)) {
+            auto decision =
+                system_manager::ai::decisions::acquire(entity, tgt.entity);
+            if (!decision) return;
             OptEntity best = find_best_toilet(entity);
             if (!best) return;
             tgt.entity.set(best.asE());
@@ -126,10 +121,9 @@ struct AIBathroomSystem
 
         bool we_are_using_it = istoilet.is_user(entity.id);
         if (!we_are_using_it) {
-            Entity& sophie = EntityHelper::getNamedEntity(NamedEntity::Sophie);
-            const IsRoundSettingsManager& irsm =
-                sophie.get<IsRoundSettingsManager>();
-            float piss_timer = irsm.get<float>(ConfigKey::PissTimer);
+            const auto* irsm = Singleton<IsRoundSettingsManager>::get_ptr();
+            if (!irsm) return;
+            float piss_timer = irsm->get<float>(ConfigKey::PissTimer);
             bs.use_toilet_timer.set_time(piss_timer);
             istoilet.start_use(entity.id);
         }
@@ -0,0 +1,118 @@
+#include "ai_blackboard.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "../../components/has_ai_target_entity.h"
+#include "../../components/has_waiting_queue.h"
+#include "../../components/is_ai_controlled.h"
+#include "../../components/is_store_spawned.h"
+#include "../../components/is_toilet.h"
+#include "../../components/transform.h"
+#include "../../engine/scratch_arena.h"
+#include "../../engine/walkable_regions.h"
+#include "../../entities/entity_type.h"
+
+namespace system_manager::ai {
+
+namespace {
+[[nodiscard]] bool can_clean_vomit(const Entity& entity) {
+    if (entity.is_missing<IsAIControlled>()) return false;
+    return entity.get<IsAIControlled>().has_ability(
+        IsAIControlled::AbilityCleanVomit);
+}
+}  // namespace
+
+void Blackboard::rebuild(const Entities& entities) {
+    registers.clear();
+    toilets.clear();
+    jukeboxes.clear();
+    vomit.clear();
+    vomit_cleaners.clear();
+
+    for (const auto& sp : entities) {
+        if (!sp) continue;
+        const Entity& entity = *sp;
+
+        if (can_clean_vomit(entity)) vomit_cleaners.push_back(entity.id);
+        if (check_type(entity, EntityType::Vomit)) vomit.push_back(entity.id);
+
+        // Queries skip store entities unless asked, and these never were
+        if (entity.has<IsStoreSpawned>()) continue;
+        if (entity.is_missing<HasWaitingQueue>()) continue;
+        if (check_type(entity, EntityType::Register))
+            registers.push_back(entity.id);
+        if (entity.has<IsToilet>()) toilets.push_back(entity.id);
+        if (check_type(entity, EntityType::Jukebox))
+            jukeboxes.push_back(entity.id);
+    }
+}
+
+OptEntity Blackboard::best_queue_target(const std::vector<EntityID>& ids,
+                                        const Entity& ai) const {
+    const vec2 from = ai.get<Transform>().as2();
+    OptEntity best;
+    int best_pos = std::numeric_limits<int>::max();
+    for (EntityID id : ids) {
+        OptEntity opt = EntityHelper::getEntityForID(id);
+        if (!opt) continue;
+        const Entity& target = opt.asE();
+        if (target.is_missing<HasWaitingQueue>()) continue;
+        const HasWaitingQueue& hwq = target.get<HasWaitingQueue>();
+        if (hwq.is_full()) continue;
+
+        int next_pos = hwq.get_next_pos();
+        // Strictly less keeps the first of equal lines, and the path check
+        // is the expensive part so skip it when this one cant win anyway
+        if (next_pos >= best_pos) continue;
+        if (!walkable_regions::can_reach(
+                from, target.get<Transform>().tile_directly_infront()))
+            continue;
+        best = opt;
+        best_pos = next_pos;
+    }
+    return best;
+}
+
+OptEntity Blackboard::nearest_unclaimed_vomit(const Entity& ai) const {
+    if (vomit.empty()) return {};
+
+    scratch::Vector<EntityID> claimed = scratch::vector<EntityID>();
+    size_t other_cleaners = 0;
+    for (EntityID id : vomit_cleaners) {
+        if (id == ai.id) continue;
+        OptEntity cleaner = EntityHelper::getEntityForID(id);
+        if (!cleaner || !can_clean_vomit(cleaner.asE())) continue;
+        other_cleaners++;
+        if (cleaner->is_missing<HasAITargetEntity>()) continue;
+        const EntityRef& ref = cleaner->get<HasAITargetEntity>().entity;
+        if (ref.empty()) continue;
+        if (std::find(claimed.begin(), claimed.end(), ref.id) != claimed.end())
+            continue;
+        claimed.push_back(ref.id);
+    }
+    const bool more_boys_than_vomit = claimed.size() < other_cleaners;
+
+    const vec2 from = ai.get<Transform>().as2();
+    OptEntity best;
+    float best_dist = std::numeric_limits<float>::max();
+    for (EntityID id : vomit) {
+        if (!more_boys_than_vomit &&
+            std::find(claimed.begin(), claimed.end(), id) != claimed.end())
+            continue;
+        OptEntity opt = EntityHelper::getEntityForID(id);
+        if (!opt) continue;
+        float dist = vec::distance_sq(from, opt->get<Transform>().as2());
+        if (dist >= best_dist) continue;
+        best = opt;
+        best_dist = dist;
+    }
+    return best;
+}
+
+Blackboard& blackboard() {
+    static Blackboard instance;
+    return instance;
+}
+
+}  // namespace system_manager::ai
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <vector>
+
+#include "../../entities/entity.h"
+#include "../../entities/entity_helper.h"
+
+// Shared world facts the customer AI keeps asking about (which registers,
+// toilets and jukeboxes exist, where the vomit is, who can mop).
+//
+// Every AI system used to find these with its own EntityQuery over every
+// entity. The blackboard keeps them as small id lists that are rebuilt only
+// when the live entity set changes (same trigger as SystemManager::oldAll),
+// since none of them can appear or disappear otherwise. Everything that does
+// change inside a tick (queue lengths, who claimed what vomit) is read live
+// off those few entities, so answers are never stale.
+namespace system_manager::ai {
+
+struct Blackboard {
+    std::vector<EntityID> registers;
+    std::vector<EntityID> toilets;
+    std::vector<EntityID> jukeboxes;
+    std::vector<EntityID> vomit;
+    // AI that can clean vomit, the only ones whose targets count as claims
+    std::vector<EntityID> vomit_cleaners;
+
+    void rebuild(const Entities& entities);
+
+    // Not full, reachable from the AI and with the shortest line, ties go to
+    // whichever came first in the entity list (same as the old queries)
+    [[nodiscard]] OptEntity best_register(const Entity& ai) const {
+        return best_queue_target(registers, ai);
+    }
+    [[nodiscard]] OptEntity best_toilet(const Entity& ai) const {
+        return best_queue_target(toilets, ai);
+    }
+    [[nodiscard]] OptEntity best_jukebox(const Entity& ai) const {
+        return best_queue_target(jukeboxes, ai);
+    }
+
+    // Closest vomit no other cleaner has claimed. When there are more
+    // cleaners than claimed vomit, doubling up is fine and any vomit counts.
+    [[nodiscard]] OptEntity nearest_unclaimed_vomit(const Entity& ai) const;
+
+   private:
+    [[nodiscard]] OptEntity best_queue_target(const std::vector<EntityID>& ids,
+                                              const Entity& ai) const;
+};
+
+// Server thread only
+Blackboard& blackboard();
+
+}  // namespace system_manager::ai
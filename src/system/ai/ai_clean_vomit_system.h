@@ -10,6 +10,7 @@
 #include "../../engine/statemanager.h"
 #include "../../entities/entity_query.h"
 #include "../../entities/entity_type.h"
+#include "ai_decision_scheduler.h"
 #include "ai_entity_helpers.h"
 #include "ai_shared_utilities.h"
 #include "ai_tags.h"
@@ -51,35 +52,12 @@ struct AICleanVomitSystem
         HasAITargetEntity& tgt = entity.get<HasAITargetEntity>();
 
         if (!system_manager::ai::entity_ref_valid(tgt.entity)) {
-            auto other_ais = EntityQuery()
-                                 .whereNotID(entity.id)
-                                 .whereHasComponent<IsAIControlled>()
-                                 .whereLambda([](const Entity& e) {
-                                     if (e.is_missing<IsAIControlled>())
-                                         return false;
-                                     return e.get<IsAIControlled>().has_ability(
-                                         IsAIControlled::AbilityCleanVomit);
-                                 })
-                                 .gen();
-            std::set<int> existing_targets;
-            for (const Entity& mop : other_ais) {
-                if (mop.is_missing<HasAITargetEntity>()) continue;
-                const EntityRef& r = mop.get<HasAITargetEntity>().entity;
-                if (r.empty()) continue;
-                existing_targets.insert(static_cast<int>(r.id));
-            }
-
-            bool more_boys_than_vomit =
-                existing_targets.size() < other_ais.size();
-
-            OptEntity vomit = EntityQuery()
-                                  .whereType(EntityType::Vomit)
-                                  .whereLambda([&](const Entity& v) {
-                                      if (more_boys_than_vomit) return true;
-                                      return !existing_targets.contains(v.id);
-                                  })
-                                  .orderByDist(entity.get<Transform>().as2())
-                                  .gen_first();
+            auto decision =
+                system_manager::ai::decisions::acquire(entity, tgt.entity);
+            if (!decision) return;
+            OptEntity vomit =
+                system_manager::ai::blackboard().nearest_unclaimed_vomit(
+                    entity);
             if (!vomit) {
                 wander_in_bar(entity, pathfind, dt);
                 return;
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "../../ah.h"
+#include "../../components/can_pathfind.h"
+#include "../../components/is_ai_controlled.h"
+#include "../../components/transform.h"
+#include "../../engine/statemanager.h"
+#include "../../engine/tracy.h"
+#include "../../entities/entity_helper.h"
+#include "../../vec_util.h"
+#include "crowd_separation.h"
+
+namespace system_manager {
+
+// Runs after AIMovementSystem has moved everyone for the tick, collects the
+// customers that actually took a step, then nudges the overlapping ones apart
+// in one pass. Customers parked in line, drinking or dwelling are left where
+// they are.
+struct AICrowdSeparationSystem
+    : public afterhours::System<IsAIControlled, CanPathfind, Transform> {
+    CrowdSeparation crowd;
+    std::vector<Entity*> agents;
+
+    bool should_run(const float) override {
+        return GameState::get().is_game_like();
+    }
+
+    virtual void once(float) override {
+        crowd.clear();
+        agents.clear();
+    }
+
+    void for_each_with(Entity& entity, IsAIControlled&, CanPathfind& pathfind,
+                       Transform& transform, float) override {
+        if (!pathfind.took_step()) return;
+        crowd.add(entity.id, transform.as2());
+        agents.push_back(&entity);
+    }
+
+    virtual void after(float dt) override {
+        TRACY_ZONE_SCOPED;
+        crowd.solve(dt);
+
+        for (size_t i = 0; i < agents.size(); i++) {
+            if (crowd.push_x[i] == 0.f && crowd.push_z[i] == 0.f) continue;
+            vec2 pos{crowd.xs[i] + crowd.push_x[i],
+                     crowd.zs[i] + crowd.push_z[i]};
+            // Never get shoved into furniture
+            if (!EntityHelper::isWalkable(vec::snap(pos))) continue;
+            agents[i]->get<Transform>().update(vec::to3(pos));
+        }
+    }
+};
+
+}  // namespace system_manager
@@ -0,0 +1,123 @@
+#include "ai_decision_scheduler.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace system_manager::ai::decisions {
+
+namespace {
+// About a tenth of a 120hz tick
+float budget_ms = 1.f;
+int num_buckets = 4;
+
+unsigned int tick_index = 0;
+Stats current;
+Stats last;
+
+// Customers that asked and are still waiting for their bucket, by id.
+// Most callers are also behind a cooldown so they do not ask every tick, an
+// exact bucket tick match would only line up when both periods happen to
+// agree (or never, when they share a factor). Instead the first ask starts
+// the wait and any ask on or after the next bucket tick gets through.
+struct Waiting {
+    unsigned int first_ask = 0;
+    unsigned int last_ask = 0;
+};
+std::unordered_map<EntityID, Waiting> waiting;
+
+// A wait this old belongs to someone who stopped asking (found a target some
+// other way, or was deleted), 2 seconds at 120hz
+constexpr unsigned int STALE_TICKS = 240;
+
+[[nodiscard]] bool in_bucket(const Entity& entity) {
+    const unsigned int buckets = (unsigned int) num_buckets;
+    auto [it, inserted] =
+        waiting.try_emplace(entity.id, Waiting{tick_index, tick_index});
+    Waiting& wait = it->second;
+    if (!inserted && tick_index - wait.last_ask > STALE_TICKS) {
+        wait.first_ask = tick_index;
+    }
+    wait.last_ask = tick_index;
+
+    // Ticks from the first ask until this bucket's turn came around
+    const unsigned int bucket = (unsigned int) entity.id % buckets;
+    const unsigned int until_turn =
+        (bucket + buckets - wait.first_ask % buckets) % buckets;
+    return tick_index - wait.first_ask >= until_turn;
+}
+
+void stop_waiting(const Entity& entity) { waiting.erase(entity.id); }
+
+[[nodiscard]] Decision grant_if_budget(bool urgent) {
+    // Urgent decisions still get charged but never turned away, otherwise a
+    // busy tick could leave someone stuck in front of a deleted register
+    if (!urgent && current.spent_ms >= budget_ms) {
+        current.over_budget++;
+        return Decision{false};
+    }
+    current.decided++;
+    if (urgent) current.urgent++;
+    return Decision{true};
+}
+}  // namespace
+
+Decision::Decision(bool g) : granted(g) {
+    if (granted) start = std::chrono::steady_clock::now();
+}
+
+Decision::Decision(Decision&& other) noexcept
+    : granted(other.granted), start(other.start) {
+    other.granted = false;
+}
+
+Decision::~Decision() {
+    if (!granted) return;
+    current.spent_ms += std::chrono::duration<float, std::milli>(
+                            std::chrono::steady_clock::now() - start)
+                            .count();
+}
+
+void begin_tick() {
+    last = current;
+    current = Stats{};
+    tick_index++;
+
+    if (tick_index % STALE_TICKS != 0) return;
+    for (auto it = waiting.begin(); it != waiting.end();) {
+        if (tick_index - it->second.last_ask > STALE_TICKS) {
+            it = waiting.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+Decision acquire(const Entity& entity, EntityRef& target) {
+    if (target.has_value()) {
+        target.clear();
+        stop_waiting(entity);
+        return grant_if_budget(true);
+    }
+    return acquire(entity);
+}
+
+Decision acquire(const Entity& entity) {
+    if (!in_bucket(entity)) {
+        current.staggered++;
+        return Decision{false};
+    }
+    Decision decision = grant_if_budget(false);
+    // Over budget keeps its place, it is already past its bucket tick
+    if (decision) stop_waiting(entity);
+    return decision;
+}
+
+void set_budget_ms(float ms) { budget_ms = std::max(0.f, ms); }
+void set_num_buckets(int buckets) {
+    num_buckets = std::max(1, buckets);
+    waiting.clear();
+}
+
+const Stats& last_tick_stats() { return last; }
+
+}  // namespace system_manager::ai::decisions
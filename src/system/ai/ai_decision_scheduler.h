@@ -0,0 +1,72 @@
+#pragma once
+
+#include <chrono>
+
+#include "../../entities/entity.h"
+#include "../../entities/entity_ref.h"
+
+// Spreads the expensive AI re-targeting decisions (find a register / toilet /
+// jukebox / vomit / wander spot, each an EntityQuery over the world) across
+// ticks so AI cost stays flat when the bar fills up.
+//
+// - Customers are staggered into buckets by id. A customer without a target
+//   waits from its first ask until its bucket's tick comes around, after that
+//   any ask goes through (callers behind a cooldown rarely ask on the exact
+//   tick).
+// - Decisions share a per tick time budget. Once it is spent everyone else
+//   waits for their next turn.
+// - A customer whose target just went away (register deleted, toilet taken
+//   out of the queue) decides right away, ignoring its bucket, so reacting to
+//   events never waits on the stagger.
+//
+//  if (!entity_ref_valid(tgt.entity)) {
+//      auto decision = ai::decisions::acquire(entity, tgt.entity);
+//      if (!decision) return;
+//      ... query and pick a new target ...
+//  }
+namespace system_manager::ai::decisions {
+
+struct Stats {
+    int decided = 0;
+    int urgent = 0;
+    // Skipped because it wasnt their bucket's tick
+    int staggered = 0;
+    // Skipped because the budget was spent
+    int over_budget = 0;
+    float spent_ms = 0.f;
+};
+
+// Times the decision it guards and charges it to this tick's budget
+struct Decision {
+    Decision() = default;
+    explicit Decision(bool granted);
+    ~Decision();
+
+    Decision(const Decision&) = delete;
+    Decision& operator=(const Decision&) = delete;
+    Decision(Decision&& other) noexcept;
+    Decision& operator=(Decision&&) = delete;
+
+    explicit operator bool() const { return granted; }
+
+   private:
+    bool granted = false;
+    std::chrono::steady_clock::time_point start{};
+};
+
+// Called once at the start of every server tick
+void begin_tick();
+
+// For decisions that replace a target ref. A ref that still has an id but no
+// longer resolves means the target was invalidated, which gets decided now
+// (and the stale id is cleared so a failed retry goes back to the buckets).
+[[nodiscard]] Decision acquire(const Entity& entity, EntityRef& target);
+// For decisions without a target ref (wander spots)
+[[nodiscard]] Decision acquire(const Entity& entity);
+
+void set_budget_ms(float ms);
+void set_num_buckets(int buckets);
+
+[[nodiscard]] const Stats& last_tick_stats();
+
+}  // namespace system_manager::ai::decisions
@@ -10,6 +10,7 @@
 #include "../../components/is_round_settings_manager.h"
 #include "../../engine/statemanager.h"
 #include "../../entities/entity_helper.h"
+#include "../../entities/singleton_component.h"
 #include "ai_entity_helpers.h"
 #include "ai_shared_utilities.h"
 #include "ai_system.h"
@@ -35,11 +36,16 @@ struct AIDrinkingSystem
 #endif
         if (ctrl.state != IsAIControlled::State::Drinking) return;
         if (entity.is_missing<CanOrderDrink>()) return;
+
+        std::optional<float> sim_dt =
+            system_manager::ai::ai_lod_step(entity, ctrl.state, dt);
+        if (!sim_dt) return;
+        dt = sim_dt.value();
+
         (void) system_manager::ai::ai_tick_with_cooldown(entity, dt, 0.25f);
 
-        Entity& sophie = EntityHelper::getNamedEntity(NamedEntity::Sophie);
-        const IsRoundSettingsManager& irsm =
-            sophie.get<IsRoundSettingsManager>();
+        const auto* irsm = Singleton<IsRoundSettingsManager>::get_ptr();
+        if (!irsm) return;
 
         CanOrderDrink& cod = entity.get<CanOrderDrink>();
         if (cod.order_state != CanOrderDrink::OrderState::DrinkingNow) return;
@@ -48,7 +54,7 @@ struct AIDrinkingSystem
         HasAIDrinkState& ds = entity.get<HasAIDrinkState>();
 
         if (!tgt.pos.has_value()) {
-            float drink_time = irsm.get<float>(ConfigKey::MaxDrinkTime);
+            float drink_time = irsm->get<float>(ConfigKey::MaxDrinkTime);
             drink_time += RandomEngine::get().get_float(0.1f, 1.f);
             ds.timer.set_time(drink_time);
             tgt.pos =
@@ -59,8 +65,14 @@ struct AIDrinkingSystem
         bool reached = pathfind.travel_toward(
             tgt.pos.value(),
             system_manager::ai::get_speed_for_entity(entity) * dt);
-        if (!reached) return;
+        if (!reached) {
+            // Pushed off the spot (or still walking there)
+            system_manager::ai::ai_lod_wake(entity);
+            return;
+        }
 
+        // Nothing left to do but finish the drink
+        system_manager::ai::ai_lod_park(entity);
         if (!ds.timer.pass_time(dt)) return;
 
         CanHoldItem& chi = entity.get<CanHoldItem>();
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "../../ah.h"
+#include "../../components/can_pathfind.h"
+#include "../../components/transform.h"
+#include "../../engine/statemanager.h"
+#include "../../engine/tracy.h"
+#include "../../vec_util.h"
+#include "movement_batch.h"
+
+namespace system_manager {
+
+// Runs after every AI state system has called travel_toward for the tick.
+// Gathers everyone who wants to take a step, moves them all in one batch,
+// then writes the positions back and turns them to face where they are
+// going.
+struct AIMovementSystem : public afterhours::System<CanPathfind, Transform> {
+    MovementBatch batch;
+    std::vector<Entity*> movers;
+    std::vector<vec2> targets;
+
+    bool should_run(const float) override {
+        return GameState::get().is_game_like();
+    }
+
+    virtual void once(float) override {
+        batch.clear();
+        movers.clear();
+        targets.clear();
+    }
+
+    void for_each_with(Entity& entity, CanPathfind& pathfind,
+                       Transform& transform, float) override {
+        vec2 target;
+        float speed = 0.f;
+        if (!pathfind.take_pending_move(target, speed)) return;
+        batch.add(transform.as2(), target, speed);
+        movers.push_back(&entity);
+        targets.push_back(target);
+    }
+
+    virtual void after(float) override {
+        {
+            TRACY_ZONE_NAMED(tracy_ai_movement, "AI movement kernel", true);
+            batch.step();
+        }
+
+        // Other customers are handled by AICrowdSeparationSystem right after
+        for (size_t i = 0; i < movers.size(); i++) {
+            Transform& transform = movers[i]->get<Transform>();
+            transform.update(vec::to3(vec2{batch.xs[i], batch.zs[i]}));
+            transform.turn_to_face_pos(targets[i]);
+        }
+    }
+};
+
+}  // namespace system_manager
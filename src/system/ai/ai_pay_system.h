@@ -11,8 +11,11 @@
 #include "../../components/transform.h"
 #include "../../engine/statemanager.h"
 #include "../../entities/entity_helper.h"
+#include "../../entities/singleton_component.h"
+#include "ai_decision_scheduler.h"
 #include "ai_entity_helpers.h"
 #include "ai_shared_utilities.h"
+#include "ai_system.h"
 #include "ai_tags.h"
 #include "ai_targeting.h"
 
@@ -41,7 +44,10 @@ struct AIPaySystem
         HasAITargetEntity& tgt = entity.get<HasAITargetEntity>();
         HasAIPayState& ps = entity.get<HasAIPayState>();
 
-        if (!system_manager::ai::entity_ref_valid(tgt.entity)) {
+        if (!system_manager::ai::line_target_valid(tgt.entity, entity)) {
+            auto decision =
+                system_manager::ai::decisions::acquire(entity, tgt.entity);
+            if (!decision) return;
             OptEntity best =
                 system_manager::ai::find_best_register_with_space(entity);
             if (!best) {
@@ -65,12 +71,11 @@ struct AIPaySystem
             ps.line_wait, reg, entity,
             system_manager::ai::get_speed_for_entity(entity) * dt, [&]() {
                 if (!ps.timer.initialized) {
-                    Entity& sophie =
-                        EntityHelper::getNamedEntity(NamedEntity::Sophie);
-                    const IsRoundSettingsManager& irsm =
-                        sophie.get<IsRoundSettingsManager>();
+                    const auto* irsm =
+                        Singleton<IsRoundSettingsManager>::get_ptr();
+                    if (!irsm) return;
                     float pay_process_time =
-                        irsm.get<float>(ConfigKey::PayProcessTime);
+                        irsm->get<float>(ConfigKey::PayProcessTime);
                     ps.timer.set_time(pay_process_time);
                 }
             });
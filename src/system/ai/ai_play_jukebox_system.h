@@ -14,6 +14,7 @@
 #include "../../entities/entity_helper.h"
 #include "../../entities/entity_query.h"
 #include "../../entities/entity_type.h"
+#include "ai_decision_scheduler.h"
 #include "ai_entity_helpers.h"
 #include "ai_shared_utilities.h"
 #include "ai_system.h"
@@ -32,18 +33,7 @@ struct AIPlayJukeboxSystem
     }
 
     OptEntity find_best_jukebox(Entity& entity) {
-        return EntityQuery()
-            .whereType(EntityType::Jukebox)
-            .whereHasComponent<HasWaitingQueue>()
-            .whereLambda([](const Entity& e) {
-                return !e.get<HasWaitingQueue>().is_full();
-            })
-            .whereCanPathfindTo(entity.get<Transform>().as2())
-            .orderByLambda([](const Entity& r1, const Entity& r2) {
-                return r1.get<HasWaitingQueue>().get_next_pos() <
-                       r2.get<HasWaitingQueue>().get_next_pos();
-            })
-            .gen_first();
+        return system_manager::ai::blackboard().best_jukebox(entity);
     }
 
     void for_each_with(Entity& entity, IsAIControlled& ctrl,
@@ -60,7 +50,10 @@ struct AIPlayJukeboxSystem
         HasAITargetEntity& tgt = entity.get<HasAITargetEntity>();
         HasAIJukeboxState& js = entity.get<HasAIJukeboxState>();
 
-        if (!system_manager::ai::entity_ref_valid(tgt.entity)) {
+        if (!system_manager::ai::line_target_valid(tgt.entity, entity)) {
+            auto decision =
+                system_manager::ai::decisions::acquire(entity, tgt.entity);
+            if (!decision) return;
             OptEntity best = find_best_jukebox(entity);
             if (!best) {
                 set_new_customer_order(entity);
@@ -5,11 +5,14 @@
 #include "../../components/can_pathfind.h"
 #include "../../components/has_ai_queue_state.h"
 #include "../../components/has_ai_target_entity.h"
+#include "../../components/has_ai_target_location.h"
 #include "../../components/is_ai_controlled.h"
 #include "../../components/transform.h"
 #include "../../engine/statemanager.h"
+#include "ai_decision_scheduler.h"
 #include "ai_entity_helpers.h"
 #include "ai_shared_utilities.h"
+#include "ai_system.h"
 #include "ai_tags.h"
 #include "ai_targeting.h"
 
@@ -25,20 +28,28 @@ struct AIQueueForRegisterSystem
     }
 
     void for_each_with(Entity& entity, IsAIControlled& ctrl,
-                       [[maybe_unused]] CanPathfind&, float dt) override {
+                       CanPathfind& pathfind, float dt) override {
 #if !__APPLE__
         if (entity.hasTag(afterhours::tags::AITag::AITransitionPending)) return;
         if (entity.hasTag(afterhours::tags::AITag::AINeedsResetting)) return;
 #endif
         if (ctrl.state != IsAIControlled::State::QueueForRegister) return;
 
+        std::optional<float> sim_dt =
+            system_manager::ai::ai_lod_step(entity, ctrl.state, dt);
+        if (!sim_dt) return;
+        dt = sim_dt.value();
+
         (void) system_manager::ai::ai_tick_with_cooldown(entity, dt, 0.10f);
         if (entity.is_missing<CanOrderDrink>()) return;
 
         HasAITargetEntity& tgt = entity.get<HasAITargetEntity>();
         HasAIQueueState& qs = entity.get<HasAIQueueState>();
 
-        if (!system_manager::ai::entity_ref_valid(tgt.entity)) {
+        if (!system_manager::ai::line_target_valid(tgt.entity, entity)) {
+            auto decision =
+                system_manager::ai::decisions::acquire(entity, tgt.entity);
+            if (!decision) return;
             OptEntity best =
                 system_manager::ai::find_best_register_with_space(entity);
             if (!best) {
@@ -66,7 +77,19 @@ struct AIQueueForRegisterSystem
             qs.line_wait, reg, entity,
             system_manager::ai::get_speed_for_entity(entity) * dt);
         qs.line_wait.queue_index = qs.line_wait.previous_line_index;
-        if (!reached_front) return;
+        if (!reached_front) {
+            // Standing in our spot behind someone, nothing changes until the
+            // line moves (line_leave wakes us up)
+            const HasAITargetLocation& spot = entity.get<HasAITargetLocation>();
+            bool parked = qs.line_wait.queue_index > 0 && spot.pos &&
+                          pathfind.is_at(spot.pos.value());
+            if (parked) {
+                system_manager::ai::ai_lod_park(entity);
+            } else {
+                system_manager::ai::ai_lod_wake(entity);
+            }
+            return;
+        }
 
         entity.get<HasSpeechBubble>().on();
         entity.get<HasPatience>().enable();
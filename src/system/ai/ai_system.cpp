@@ -183,6 +183,27 @@ float get_speed_for_entity(Entity& entity) {
     return true;
 }
 
+[[nodiscard]] std::optional<float> ai_lod_step(Entity& entity,
+                                               IsAIControlled::State state,
+                                               float dt) {
+    HasAICooldown& cd = entity.addComponentIfMissing<HasAICooldown>();
+    // Time piled up in the last state belongs to it, not to this one
+    if (cd.lod_state != state) {
+        cd.lod.reset();
+        cd.lod_state = state;
+    }
+    return cd.lod.step(dt);
+}
+
+void ai_lod_park(Entity& entity) {
+    entity.addComponentIfMissing<HasAICooldown>().lod.reduce(entity.id);
+}
+
+void ai_lod_wake(Entity& entity) {
+    if (entity.is_missing<HasAICooldown>()) return;
+    entity.get<HasAICooldown>().lod.promote();
+}
+
 [[nodiscard]] std::optional<vec2> pick_random_walkable_near(const Entity& e,
                                                             int attempts) {
     const vec2 base = e.get<Transform>().as2();
@@ -291,7 +312,27 @@ void line_leave(AIWaitInQueueState& s, Entity& reg, const Entity& entity) {
              "queue");
     int pos = line_position_in_line(s, reg, entity);
     if (pos == -1) return;
-    reg.get<HasWaitingQueue>().erase(pos);
+    HasWaitingQueue& hwq = reg.get<HasWaitingQueue>();
+    hwq.erase(pos);
+
+    // The line moved, everyone still in it gets to walk up this tick
+    for (int i = 0; i < hwq.get_next_pos(); i++) {
+        OptEntity waiting = EntityHelper::getEntityForID(hwq.person(i));
+        if (waiting) ai_lod_wake(waiting.asE());
+    }
+}
+
+[[nodiscard]] bool line_target_valid(const EntityRef& ref,
+                                     const Entity& entity) {
+    if (ref.empty()) return false;
+    OptEntity target = ref.resolve();
+    if (!target) return false;
+    if (target->is_missing<HasWaitingQueue>()) return true;
+    const HasWaitingQueue& hwq = target->get<HasWaitingQueue>();
+    for (int i = 0; i < HasWaitingQueue::max_queue_size; i++) {
+        if (hwq.matching_id(entity.id, i)) return true;
+    }
+    return false;
 }
 
 }  // namespace system_manager::ai
@@ -24,6 +24,18 @@ float get_speed_for_entity(Entity& entity);
 [[nodiscard]] bool ai_tick_with_cooldown(Entity& entity, float dt,
                                          float reset_to_seconds);
 
+// Simulation LOD for the passive states (waiting in line, drinking, dwelling
+// while wandering). Returns how much time this tick's logic should simulate,
+// nothing when the entity sits this tick out. Starts at full rate every time
+// the state changes.
+[[nodiscard]] std::optional<float> ai_lod_step(Entity& entity,
+                                               IsAIControlled::State state,
+                                               float dt);
+// Parked with nothing to do but wait, drop to the reduced rate
+void ai_lod_park(Entity& entity);
+// Something happened that wants an answer this tick
+void ai_lod_wake(Entity& entity);
+
 [[nodiscard]] std::optional<vec2> pick_random_walkable_near(const Entity& e,
                                                             int attempts = 50);
 
@@ -40,5 +52,10 @@ void line_add_to_queue(Entity& entity, AIWaitInQueueState& s, Entity& reg);
     AIWaitInQueueState& s, Entity& reg, Entity& entity, float distance,
     const std::function<void()>& onReachedFront = nullptr);
 void line_leave(AIWaitInQueueState& s, Entity& reg, const Entity& entity);
+// Like entity_ref_valid, but for targets with a line. Not being in that line
+// (it was cleared, or filled up before we got in) counts as the target being
+// invalidated, so decisions::acquire re-decides right away.
+[[nodiscard]] bool line_target_valid(const EntityRef& ref,
+                                     const Entity& entity);
 
 }  // namespace system_manager::ai
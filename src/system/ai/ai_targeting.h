@@ -1,32 +1,14 @@
 #pragma once
 
-#include "../../components/has_waiting_queue.h"
-#include "../../components/transform.h"
 #include "../../entities/entity.h"
-#include "../../entities/entity_query.h"
+#include "ai_blackboard.h"
 
 namespace system_manager::ai {
 // TODO merge into shared utilities
 
 [[nodiscard]] inline OptEntity find_best_register_with_space(
     const Entity& ai_entity) {
-    return EntityQuery()
-        .whereType(EntityType::Register)
-        .whereHasComponent<HasWaitingQueue>()
-        .whereLambda([](const Entity& entity) {
-            const HasWaitingQueue& hwq = entity.get<HasWaitingQueue>();
-            return !hwq.is_full();
-        })
-        .whereCanPathfindTo(ai_entity.get<Transform>().as2())
-        // Find the register with the least people on it.
-        .orderByLambda([](const Entity& r1, const Entity& r2) {
-            const HasWaitingQueue& hwq1 = r1.get<HasWaitingQueue>();
-            int rpos1 = hwq1.get_next_pos();
-            const HasWaitingQueue& hwq2 = r2.get<HasWaitingQueue>();
-            int rpos2 = hwq2.get_next_pos();
-            return rpos1 < rpos2;
-        })
-        .gen_first();
+    return blackboard().best_register(ai_entity);
 }
 
 }  // namespace system_manager::ai
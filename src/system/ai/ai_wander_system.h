@@ -8,8 +8,11 @@
 #include "../../components/is_round_settings_manager.h"
 #include "../../engine/statemanager.h"
 #include "../../entities/entity_helper.h"
+#include "../../entities/singleton_component.h"
+#include "ai_decision_scheduler.h"
 #include "ai_entity_helpers.h"
 #include "ai_shared_utilities.h"
+#include "ai_system.h"
 #include "ai_tags.h"
 #include "ai_targeting.h"
 
@@ -32,17 +35,23 @@ struct AIWanderSystem
 #endif
         if (ctrl.state != IsAIControlled::State::Wander) return;
 
+        std::optional<float> sim_dt =
+            system_manager::ai::ai_lod_step(entity, ctrl.state, dt);
+        if (!sim_dt) return;
+        dt = sim_dt.value();
+
         (void) system_manager::ai::ai_tick_with_cooldown(entity, dt, 0.25f);
 
         HasAITargetLocation& tgt = entity.get<HasAITargetLocation>();
         HasAIWanderState& ws = entity.get<HasAIWanderState>();
 
         if (!tgt.pos.has_value()) {
-            Entity& sophie = EntityHelper::getNamedEntity(NamedEntity::Sophie);
-            const IsRoundSettingsManager& irsm =
-                sophie.get<IsRoundSettingsManager>();
+            auto decision = system_manager::ai::decisions::acquire(entity);
+            if (!decision) return;
+            const auto* irsm = Singleton<IsRoundSettingsManager>::get_ptr();
+            if (!irsm) return;
 
-            float max_dwell_time = irsm.get<float>(ConfigKey::MaxDwellTime);
+            float max_dwell_time = irsm->get<float>(ConfigKey::MaxDwellTime);
             float dwell_time =
                 RandomEngine::get().get_float(1.f, max_dwell_time);
             ws.timer.set_time(dwell_time);
@@ -55,8 +64,13 @@ struct AIWanderSystem
         bool reached = pathfind.travel_toward(
             tgt.pos.value(),
             system_manager::ai::get_speed_for_entity(entity) * dt);
-        if (!reached) return;
+        if (!reached) {
+            system_manager::ai::ai_lod_wake(entity);
+            return;
+        }
 
+        // Standing around until the dwell time is up
+        system_manager::ai::ai_lod_park(entity);
         if (!ws.timer.pass_time(dt)) return;
 
         tgt.pos.reset();
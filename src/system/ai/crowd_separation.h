@@ -0,0 +1,134 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "../../entities/entity.h"
+
+// Local avoidance for customers, applied after everyone has moved for the
+// tick. Paths only know about furniture, so customers heading for the same
+// spot walk right through each other and pile up on one tile. This pushes
+// overlapping customers apart a little every tick instead of asking for new
+// paths.
+//
+// Agents are bucketed into a grid of radius sized cells (counting sort, no
+// maps) so each one only looks at the 3x3 cells around it, and everything is
+// kept as flat float arrays so the inner loop is plain math over contiguous
+// memory.
+struct CrowdSeparation {
+    // Closer than this (in tiles) and two customers are overlapping. Queue
+    // spots are a full tile apart so lines never trigger it.
+    float radius = 0.6f;
+    // Fastest a customer gets pushed, in tiles per second
+    float push_speed = 2.f;
+
+    std::vector<EntityID> ids;
+    std::vector<float> xs;
+    std::vector<float> zs;
+    // Output of solve(), how far to move each agent this tick
+    std::vector<float> push_x;
+    std::vector<float> push_z;
+
+    void clear() {
+        ids.clear();
+        xs.clear();
+        zs.clear();
+    }
+
+    void add(EntityID id, vec2 pos) {
+        ids.push_back(id);
+        xs.push_back(pos.x);
+        zs.push_back(pos.y);
+    }
+
+    [[nodiscard]] size_t size() const { return ids.size(); }
+
+    void solve(float dt) {
+        const size_t n = ids.size();
+        push_x.assign(n, 0.f);
+        push_z.assign(n, 0.f);
+        if (n < 2) return;
+
+        bucket();
+
+        const float r2 = radius * radius;
+        for (size_t i = 0; i < n; i++) {
+            int cx = cell_x[i];
+            int cz = cell_z[i];
+            float px = 0.f;
+            float pz = 0.f;
+            for (int gz = std::max(0, cz - 1);
+                 gz <= std::min(grid_h - 1, cz + 1); gz++) {
+                for (int gx = std::max(0, cx - 1);
+                     gx <= std::min(grid_w - 1, cx + 1); gx++) {
+                    size_t cell = (size_t) (gz * grid_w + gx);
+                    for (size_t k = cell_start[cell]; k < cell_start[cell + 1];
+                         k++) {
+                        size_t j = cell_items[k];
+                        if (j == i) continue;
+                        float dx = xs[i] - xs[j];
+                        float dz = zs[i] - zs[j];
+                        float d2 = dx * dx + dz * dz;
+                        if (d2 >= r2) continue;
+                        if (d2 < 1e-6f) {
+                            // Exactly on top of each other, split them along
+                            // x by index so both dont go the same way
+                            px += i < j ? 1.f : -1.f;
+                            continue;
+                        }
+                        float d = std::sqrt(d2);
+                        float overlap = (radius - d) / radius;
+                        px += dx / d * overlap;
+                        pz += dz / d * overlap;
+                    }
+                }
+            }
+
+            float len = std::sqrt(px * px + pz * pz);
+            if (len < 1e-6f) continue;
+            float step = std::min(len, 1.f) * push_speed * dt;
+            push_x[i] = px / len * step;
+            push_z[i] = pz / len * step;
+        }
+    }
+
+   private:
+    void bucket() {
+        const size_t n = ids.size();
+        float min_x = *std::min_element(xs.begin(), xs.end());
+        float min_z = *std::min_element(zs.begin(), zs.end());
+        float max_x = *std::max_element(xs.begin(), xs.end());
+        float max_z = *std::max_element(zs.begin(), zs.end());
+
+        grid_w = (int) ((max_x - min_x) / radius) + 1;
+        grid_h = (int) ((max_z - min_z) / radius) + 1;
+
+        cell_x.resize(n);
+        cell_z.resize(n);
+        cell_start.assign((size_t) (grid_w * grid_h) + 1, 0);
+        for (size_t i = 0; i < n; i++) {
+            cell_x[i] = std::min(grid_w - 1, (int) ((xs[i] - min_x) / radius));
+            cell_z[i] = std::min(grid_h - 1, (int) ((zs[i] - min_z) / radius));
+            cell_start[(size_t) (cell_z[i] * grid_w + cell_x[i]) + 1]++;
+        }
+        for (size_t c = 1; c < cell_start.size(); c++) {
+            cell_start[c] += cell_start[c - 1];
+        }
+
+        cell_items.resize(n);
+        cell_fill.assign(cell_start.begin(), cell_start.end() - 1);
+        for (size_t i = 0; i < n; i++) {
+            size_t cell = (size_t) (cell_z[i] * grid_w + cell_x[i]);
+            cell_items[cell_fill[cell]++] = i;
+        }
+    }
+
+    int grid_w = 0;
+    int grid_h = 0;
+    std::vector<int> cell_x;
+    std::vector<int> cell_z;
+    std::vector<size_t> cell_start;
+    std::vector<size_t> cell_fill;
+    std::vector<size_t> cell_items;
+};
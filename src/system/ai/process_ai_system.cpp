@@ -5,8 +5,10 @@
 #include "ai_at_register_wait_for_drink_system.h"
 #include "ai_bathroom_system.h"
 #include "ai_clean_vomit_system.h"
+#include "ai_crowd_separation_system.h"
 #include "ai_drinking_system.h"
 #include "ai_leave_system.h"
+#include "ai_movement_system.h"
 #include "ai_pay_system.h"
 #include "ai_play_jukebox_system.h"
 #include "ai_queue_for_register_system.h"
@@ -27,6 +29,11 @@ void register_ai_systems(afterhours::SystemManager& systems) {
     systems.register_update_system(std::make_unique<AIBathroomSystem>());
     systems.register_update_system(std::make_unique<AICleanVomitSystem>());
     systems.register_update_system(std::make_unique<AILeaveSystem>());
+    // After every state system has picked where to step
+    systems.register_update_system(std::make_unique<AIMovementSystem>());
+    // After everyone has moved for the tick
+    systems.register_update_system(
+        std::make_unique<AICrowdSeparationSystem>());
 }
 
 }  // namespace system_manager
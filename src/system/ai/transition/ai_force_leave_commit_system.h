@@ -5,6 +5,7 @@
 #include "../../../components/is_ai_controlled.h"
 #include "../../../engine/statemanager.h"
 #include "../../../entities/entity_helper.h"
+#include "../../../entities/singleton_component.h"
 #include "../ai_system.h"
 #include "../ai_tags.h"
 
@@ -15,18 +16,13 @@ namespace system_manager {
 struct AIForceLeaveCommitSystem : public afterhours::System<IsAIControlled> {
     bool should_run(const float) override {
         if (!GameState::get().is_game_like()) return false;
-        try {
-            Entity& sophie = EntityHelper::getNamedEntity(NamedEntity::Sophie);
-            const HasDayNightTimer& timer = sophie.get<HasDayNightTimer>();
-            // Mirror existing day/night transition systems: "leaving in-round"
-            // happens while processing the close-bar transition.
-            // TODO: Refactor this duplicated day/night transition check into a
-            // shared helper (many systems repeat this Sophie + HasDayNightTimer
-            // lookup and condition).
-            return timer.needs_to_process_change && timer.is_bar_closed();
-        } catch (...) {
-            return false;
-        }
+        const auto* timer = Singleton<HasDayNightTimer>::get_ptr();
+        if (!timer) return false;
+        // Mirror existing day/night transition systems: "leaving in-round"
+        // happens while processing the close-bar transition.
+        // TODO: Refactor this duplicated day/night transition check into a
+        // shared helper (many systems repeat this condition).
+        return timer->needs_to_process_change && timer->is_bar_closed();
     }
 
     void for_each_with(Entity& entity, IsAIControlled& ai, float) override {
@@ -18,8 +18,8 @@
 #include "../../components/transform.h"
 #include "../../dataclass/ingredient.h"
 #include "../../engine/assert.h"
-#include "../../engine/pathfinder.h"
 #include "../../engine/runtime_globals.h"
+#include "../../engine/walkable_regions.h"
 #include "../../entities/entity_helper.h"
 #include "../../entities/entity_query.h"
 #include "../helpers/ingredient_helper.h"
@@ -200,12 +200,11 @@ void lightweight_map_validation(Entity& entity) {
             bad_spot_reg_location = r.get<Transform>().as2();
         }
 
-        auto new_path = pathfinder::find_path(
+        bool can_reach = walkable_regions::can_reach(
             customer.get<Transform>().as2(),
-            r.get<Transform>().tile_directly_infront(),
-            std::bind(EntityHelper::isWalkable, std::placeholders::_1));
+            r.get<Transform>().tile_directly_infront());
 
-        if (new_path.empty()) {
+        if (!can_reach) {
             reg_with_no_pathing++;
             non_pathable_reg_location = r.get<Transform>().as2();
         }
@@ -0,0 +1,144 @@
+#include "system_groups.h"
+
+#include <mutex>
+
+#include "../../components/has_day_night_timer.h"
+#include "../../engine/statemanager.h"
+#include "../../entities/singleton_component.h"
+#include "../system_utilities.h"
+
+namespace system_groups {
+
+namespace {
+
+std::array<bool, NUM_GROUPS> active{};
+
+std::array<Timing, NUM_GROUPS>& mutable_group_timings() {
+    // Timing holds atomics so it cant be copied out of a builder, name the
+    // entries in place the first time through instead
+    static std::array<Timing, NUM_GROUPS> timings;
+    static std::once_flag named;
+    std::call_once(named, []() {
+        for (size_t i = 0; i < NUM_GROUPS; i++) {
+            timings[i].name = std::string(magic_enum::enum_name<SystemGroup>(
+                magic_enum::enum_value<SystemGroup>(i)));
+        }
+    });
+    return timings;
+}
+
+std::deque<Timing>& mutable_system_timings() {
+    static std::deque<Timing> timings;
+    return timings;
+}
+
+bool evaluate_gate(SystemGroup group) {
+    switch (group) {
+        case SystemGroup::SixtyFps:
+        case SystemGroup::ModelTest:
+            // These run in every state and gate themselves
+            return true;
+        case SystemGroup::GameLike:
+            return GameState::get().is_game_like();
+        case SystemGroup::DayNightTransition: {
+            if (!GameState::get().is_game_like()) return false;
+            const auto* timer = Singleton<HasDayNightTimer>::get_ptr();
+            return timer && timer->needs_to_process_change;
+        }
+        case SystemGroup::InRound:
+            return system_utils::should_run_inround_system();
+        case SystemGroup::Planning:
+            return system_utils::should_run_planning_system();
+    }
+    return false;
+}
+
+struct GroupBeginSystem : public afterhours::System<> {
+    SystemGroup group;
+    explicit GroupBeginSystem(SystemGroup g) : group(g) {}
+
+    virtual bool should_run(const float) override {
+        mutable_group_timings()[(size_t) group].begin();
+        active[(size_t) group] = evaluate_gate(group);
+        return false;
+    }
+};
+
+struct GroupEndSystem : public afterhours::System<> {
+    SystemGroup group;
+    explicit GroupEndSystem(SystemGroup g) : group(g) {}
+
+    virtual bool should_run(const float) override {
+        mutable_group_timings()[(size_t) group].end();
+        return false;
+    }
+};
+
+struct TimingBeginSystem : public afterhours::System<> {
+    Timing& timing;
+    explicit TimingBeginSystem(Timing& t) : timing(t) {}
+
+    virtual bool should_run(const float) override {
+        timing.begin();
+        return false;
+    }
+};
+
+struct TimingEndSystem : public afterhours::System<> {
+    Timing& timing;
+    explicit TimingEndSystem(Timing& t) : timing(t) {}
+
+    virtual bool should_run(const float) override {
+        timing.end();
+        return false;
+    }
+};
+
+}  // namespace
+
+void Timing::end() {
+    auto now = std::chrono::high_resolution_clock::now();
+    float ms =
+        std::chrono::duration<float, std::milli>(now - start).count();
+    last_ms.store(ms, std::memory_order_relaxed);
+    // Roughly the last second of ticks
+    float avg = avg_ms.load(std::memory_order_relaxed);
+    avg_ms.store(avg + (ms - avg) * 0.02f, std::memory_order_relaxed);
+}
+
+std::string_view short_name(std::string_view name) {
+    constexpr std::string_view prefix = "system_manager::";
+    if (name.starts_with(prefix)) name.remove_prefix(prefix.size());
+    return name;
+}
+
+bool is_active(SystemGroup group) { return active[(size_t) group]; }
+
+const std::array<Timing, NUM_GROUPS>& group_timings() {
+    return mutable_group_timings();
+}
+
+const std::deque<Timing>& system_timings() { return mutable_system_timings(); }
+
+namespace detail {
+
+Timing& add_system_timing(std::string_view name) {
+    return mutable_system_timings().emplace_back(std::string(short_name(name)));
+}
+
+std::unique_ptr<afterhours::SystemBase> make_group_begin(SystemGroup group) {
+    return std::make_unique<GroupBeginSystem>(group);
+}
+std::unique_ptr<afterhours::SystemBase> make_group_end(SystemGroup group) {
+    return std::make_unique<GroupEndSystem>(group);
+}
+std::unique_ptr<afterhours::SystemBase> make_timing_begin(Timing& timing) {
+    return std::make_unique<TimingBeginSystem>(timing);
+}
+std::unique_ptr<afterhours::SystemBase> make_timing_end(Timing& timing) {
+    return std::make_unique<TimingEndSystem>(timing);
+}
+
+}  // namespace detail
+
+}  // namespace system_groups
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "../../ah.h"
+#include "../../engine/type_name.h"
+#include "magic_enum/magic_enum.hpp"
+#include "system_scheduler.h"
+
+// Systems are registered in groups (sixtyfps, gamelike, in round, ...). Each
+// group has one gate that is evaluated once per tick when the group starts,
+// so systems in the group only have to read a cached bool instead of
+// repeating the game state / day night timer checks themselves.
+//
+// Registration also drops cheap marker systems around every group and every
+// system so we can see which phase is eating the tick. Markers do their work
+// in should_run() and always return false so they never touch the entities.
+enum struct SystemGroup {
+    SixtyFps,
+    GameLike,
+    DayNightTransition,
+    ModelTest,
+    InRound,
+    Planning,
+};
+
+namespace system_groups {
+
+constexpr size_t NUM_GROUPS = magic_enum::enum_count<SystemGroup>();
+
+// Result of the group gate for this tick. Only meaningful for systems
+// registered inside that group since the gate is evaluated when the group
+// starts ticking.
+[[nodiscard]] bool is_active(SystemGroup group);
+
+struct Timing {
+    std::string name;
+    // Written by the thread ticking the systems, read by the debug overlay
+    std::atomic<float> last_ms{0.f};
+    std::atomic<float> avg_ms{0.f};
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    Timing() = default;
+    explicit Timing(std::string n) : name(std::move(n)) {}
+    void begin() { start = std::chrono::high_resolution_clock::now(); }
+    void end();
+};
+
+// Both lists are only appended to while SystemManager registers its systems,
+// so reading them afterwards from another thread is fine
+[[nodiscard]] const std::array<Timing, NUM_GROUPS>& group_timings();
+[[nodiscard]] const std::deque<Timing>& system_timings();
+
+namespace detail {
+Timing& add_system_timing(std::string_view name);
+}  // namespace detail
+
+// type_name gives us the fully qualified name, which is a lot to read on the
+// overlay
+[[nodiscard]] std::string_view short_name(std::string_view name);
+
+namespace detail {
+std::unique_ptr<afterhours::SystemBase> make_group_begin(SystemGroup group);
+std::unique_ptr<afterhours::SystemBase> make_group_end(SystemGroup group);
+std::unique_ptr<afterhours::SystemBase> make_timing_begin(Timing& timing);
+std::unique_ptr<afterhours::SystemBase> make_timing_end(Timing& timing);
+}  // namespace detail
+
+// Registers everything added through it into one group
+//
+//  {
+//      system_groups::GroupRegistrar group(systems, SystemGroup::InRound);
+//      group.add<ProcessSpawnerSystem>();
+//  }
+struct GroupRegistrar {
+    GroupRegistrar(afterhours::SystemManager& sm, SystemGroup g)
+        : systems(sm), group(g) {
+        systems.register_update_system(detail::make_group_begin(group));
+    }
+    ~GroupRegistrar() {
+        systems.register_update_system(detail::make_group_end(group));
+    }
+
+    GroupRegistrar(const GroupRegistrar&) = delete;
+    GroupRegistrar& operator=(const GroupRegistrar&) = delete;
+
+    template<typename T, typename... Args>
+    void add(Args&&... args) {
+        add_timed(type_name<T>(), [&]() {
+            systems.register_update_system(
+                std::make_unique<T>(std::forward<Args>(args)...));
+        });
+    }
+
+    // Systems that declared a static access() and can share the job pool,
+    // they keep their order relative to anything they conflict with
+    template<typename... Systems>
+    void add_parallel() {
+        auto batch = std::make_unique<ParallelSystemBatch>();
+        (batch->add(std::make_unique<Systems>(), Systems::access()), ...);
+
+        std::string name = "parallel";
+        for (std::string_view n : {short_name(type_name<Systems>())...}) {
+            name += fmt::format(" {}", n);
+        }
+        add_timed(name, [&]() {
+            systems.register_update_system(std::move(batch));
+        });
+    }
+
+    // For the register_*_systems helpers that live next to their systems
+    // (ai, triggers, input), those get timed as one block
+    template<typename Fn>
+    void add_timed(std::string_view name, Fn&& register_fn) {
+        Timing& timing = detail::add_system_timing(name);
+        systems.register_update_system(detail::make_timing_begin(timing));
+        register_fn();
+        systems.register_update_system(detail::make_timing_end(timing));
+    }
+
+    afterhours::SystemManager& systems;
+    SystemGroup group;
+};
+
+}  // namespace system_groups
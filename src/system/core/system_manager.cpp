@@ -3,6 +3,8 @@
 #include "system_manager.h"
 
 #include "../afterhours/afterhours_systems.h"
+#include "../ai/ai_blackboard.h"
+#include "../ai/ai_decision_scheduler.h"
 #include "../helpers/store_management_helpers.h"
 #include "entities/entity.h"
 
@@ -38,9 +40,11 @@
 #include "../../engine/input_helper.h"
 #include "../../engine/pathfinder.h"
 #include "../../engine/runtime_globals.h"
+#include "../../engine/scratch_arena.h"
 #include "../../engine/tracy.h"
 #include "../../entities/entity_helper.h"
 #include "../../entities/entity_query.h"
+#include "../../entities/singleton_component.h"
 #include "../../map.h"
 #include "../../network/server.h"
 #include "../ai/ai_system.h"
@@ -274,27 +278,54 @@ void update_visuals_for_settings_changer(Entity& entity, float) {
 
 }  // namespace system_manager
 
-void SystemManager::update_all_entities(const Entities& players, float dt) {
-    // TODO speed?
-    Entities entities;
-    Entities ents = EntityHelper::get_entities();
-
-    entities.reserve(players.size() + ents.size());
+bool SystemManager::live_entities_changed(const Entities& ents,
+                                          const Entities& players) const {
+    size_t i = 0;
+    const auto matches = [&](const Entities& list) {
+        for (const auto& ent : list) {
+            if (!ent || ent->cleanup) continue;
+            if (i >= oldAll.size() || oldAll[i].get() != ent.get())
+                return false;
+            i++;
+        }
+        return true;
+    };
+    return !(matches(ents) && matches(players) && i == oldAll.size());
+}
 
-    // Filter out null and cleanup entities when building the list
-    for (const auto& ent : ents) {
-        if (ent && !ent->cleanup) {
-            entities.push_back(ent);
+void SystemManager::update_all_entities(const Entities& players, float dt) {
+    // Singleton<T> lookups resolve at most once per tick
+    EntityHelper::invalidateReferences();
+    // Everything created last tick has been merged by now
+    EntityHelper::prunePendingIndex();
+    // Nothing from last tick's scratch lists is still alive
+    scratch::arena().reset();
+    system_manager::ai::decisions::begin_tick();
+
+    const Entities& ents = EntityHelper::get_entities();
+
+    // Comparing raw pointers is way cheaper than copying every shared_ptr
+    // (two atomic ops each) so only rebuild the list when something was
+    // added, removed or marked for cleanup
+    if (live_entities_changed(ents, players)) {
+        oldAll.clear();
+        oldAll.reserve(players.size() + ents.size());
+
+        // Filter out null and cleanup entities when building the list
+        for (const auto& ent : ents) {
+            if (ent && !ent->cleanup) {
+                oldAll.push_back(ent);
+            }
         }
-    }
-    for (const auto& player : players) {
-        if (player && !player->cleanup) {
-            entities.push_back(player);
+        for (const auto& player : players) {
+            if (player && !player->cleanup) {
+                oldAll.push_back(player);
+            }
         }
+        // Registers, toilets, vomit etc can only come and go with the list
+        system_manager::ai::blackboard().rebuild(oldAll);
     }
 
-    oldAll = entities;
-
     // should we not do any updates for client?
     // any changes will get overwritten by server every frame
     // but maybe itll matter
@@ -319,12 +350,17 @@ void SystemManager::update_all_entities(const Entities& players, float dt) {
         timePassed = 0;
     }
 
+    // positions change every tick so this cant be cached like oldAll
+    player_transforms.rebuild(oldAll, [](const Entity& entity) {
+        return entity.hasTag(EntityType::Player);
+    });
+
     // actual update
     {
         // TODO add num entities to debug overlay
-        // log_info("num entities {}", entities.size());
+        // log_info("num entities {}", oldAll.size());
 
-        PathRequestManager::process_responses(entities);
+        PathRequestManager::process_responses(oldAll);
         // Run afterhours systems
         // Note: systems.tick() expects a non-const Entities&
         // We use oldAll which contains the same entities but is mutable
@@ -333,11 +369,13 @@ void SystemManager::update_all_entities(const Entities& players, float dt) {
 }
 
 void SystemManager::update_remote_players(const Entities& players, float) {
-    remote_players = players;
+    // vector == only compares the pointers, so this skips the refcount churn
+    // on the (usual) frames where nobody joined or left
+    if (remote_players != players) remote_players = players;
 }
 
 void SystemManager::update_local_players(const Entities& players, float dt) {
-    local_players = players;
+    if (local_players != players) local_players = players;
     // Poll raw input before collecting user input
     input_helper::poll(dt);
     for (const auto& entity : players) {
@@ -379,10 +417,8 @@ void SystemManager::render_ui(const Entities& entities, float dt) const {
 }
 
 bool SystemManager::is_bar_open() const {
-    for (const auto& entity : oldAll) {
-        if (entity->is_missing<HasDayNightTimer>()) continue;
-        return entity->get<HasDayNightTimer>().is_bar_open();
-    }
-    return false;
+    // Called per entity from a couple render paths, so dont scan oldAll
+    const auto* timer = Singleton<HasDayNightTimer>::get_ptr();
+    return timer && timer->is_bar_open();
 }
 bool SystemManager::is_bar_closed() const { return !is_bar_open(); }
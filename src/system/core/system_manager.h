@@ -8,6 +8,7 @@
 #include "../../engine/keymap.h"
 #include "../../engine/singleton.h"
 #include "../../entities/entity.h"
+#include "../../entities/transform_stream.h"
 
 using afterhours::Entities;
 
@@ -24,7 +25,11 @@ struct SystemManager {
 
     Entities local_players;
     Entities remote_players;
+    // Every live (non cleanup) entity plus the players, systems tick over
+    // this. Only rebuilt when that set changes.
     Entities oldAll;
+    // Players out of oldAll, rebuilt every tick for the trigger area counts
+    TransformStream player_transforms;
 
     // so that we run the first time always
     float timePassed = 0.016f;
@@ -65,4 +70,6 @@ struct SystemManager {
     void register_input_systems();
 
     void every_frame_update(const Entities& entity_list, float dt);
+    [[nodiscard]] bool live_entities_changed(const Entities& ents,
+                                             const Entities& players) const;
 };
@@ -0,0 +1,115 @@
+#include "system_scheduler.h"
+
+#include <algorithm>
+#include <functional>
+
+#include "../../engine/job_pool.h"
+#include "../../engine/tracy.h"
+#include "system_manager.h"
+
+namespace {
+
+JobPool& job_pool() {
+    static JobPool pool(JobPool::default_worker_count());
+    return pool;
+}
+
+bool contains(const std::vector<afterhours::ComponentID>& ids,
+              afterhours::ComponentID id) {
+    return std::find(ids.begin(), ids.end(), id) != ids.end();
+}
+
+// Below this it is not worth waking the pool up
+constexpr size_t MIN_ENTITIES_PER_CHUNK = 64;
+
+}  // namespace
+
+bool SystemAccess::conflicts_with(const SystemAccess& other) const {
+    for (afterhours::ComponentID id : write_ids) {
+        if (contains(other.write_ids, id) || contains(other.read_ids, id))
+            return true;
+    }
+    for (afterhours::ComponentID id : other.write_ids) {
+        if (contains(read_ids, id)) return true;
+    }
+    return false;
+}
+
+std::vector<int> ParallelSystemBatch::build_waves(
+    const std::vector<const SystemAccess*>& running) {
+    std::vector<int> waves(running.size(), -1);
+    for (size_t i = 0; i < running.size(); i++) {
+        if (!running[i]) continue;
+        int wave = 0;
+        for (size_t j = 0; j < i; j++) {
+            if (!running[j]) continue;
+            if (!running[i]->conflicts_with(*running[j])) continue;
+            wave = std::max(wave, waves[j] + 1);
+        }
+        waves[i] = wave;
+    }
+    return waves;
+}
+
+bool ParallelSystemBatch::should_run(const float dt) {
+    run(SystemManager::get().oldAll, dt);
+    return false;
+}
+
+void ParallelSystemBatch::run(afterhours::Entities& entities, float dt) {
+    TRACY_ZONE_SCOPED;
+
+    std::vector<const SystemAccess*> running(entries.size(), nullptr);
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (!entries[i].system->should_run(dt)) continue;
+        running[i] = &entries[i].access;
+    }
+
+    const std::vector<int> waves = build_waves(running);
+    int num_waves = 0;
+    for (int w : waves) num_waves = std::max(num_waves, w + 1);
+
+    JobPool& pool = job_pool();
+    const size_t chunk_size = std::max(
+        MIN_ENTITIES_PER_CHUNK, entities.size() / pool.concurrency() + 1);
+
+    std::vector<std::function<void()>> jobs;
+    for (int wave = 0; wave < num_waves; wave++) {
+        jobs.clear();
+        std::vector<afterhours::SystemBase*> chunked;
+
+        for (size_t i = 0; i < entries.size(); i++) {
+            if (waves[i] != wave) continue;
+            afterhours::SystemBase* system = entries[i].system.get();
+
+            if (entries[i].access.chunkable &&
+                entities.size() > MIN_ENTITIES_PER_CHUNK) {
+                system->once(dt);
+                chunked.push_back(system);
+                for (size_t start = 0; start < entities.size();
+                     start += chunk_size) {
+                    size_t end = std::min(entities.size(), start + chunk_size);
+                    jobs.emplace_back([system, &entities, start, end, dt]() {
+                        for (size_t e = start; e < end; e++) {
+                            if (!entities[e]) continue;
+                            system->for_each(*entities[e], dt);
+                        }
+                    });
+                }
+                continue;
+            }
+
+            jobs.emplace_back([system, &entities, dt]() {
+                system->once(dt);
+                for (const auto& entity : entities) {
+                    if (!entity) continue;
+                    system->for_each(*entity, dt);
+                }
+                system->after(dt);
+            });
+        }
+
+        pool.run(jobs);
+        for (afterhours::SystemBase* system : chunked) system->after(dt);
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../ah.h"
+
+// Which components a system touches, declared by systems that are safe to
+// run next to others:
+//
+//  static SystemAccess access() {
+//      return SystemAccess{}.reads<Transform>().writes<HasPatience>();
+//  }
+//
+// By declaring it the system also promises it does not create or delete
+// entities and does not touch anything global outside of those components
+// (logging is fine).
+struct SystemAccess {
+    std::vector<afterhours::ComponentID> read_ids;
+    std::vector<afterhours::ComponentID> write_ids;
+    // Every entity can be processed independently, so for_each_with can be
+    // split across the pool
+    bool chunkable = false;
+
+    template<typename... Components>
+    SystemAccess& reads() {
+        (read_ids.push_back(afterhours::components::get_type_id<Components>()),
+         ...);
+        return *this;
+    }
+
+    template<typename... Components>
+    SystemAccess& writes() {
+        (write_ids.push_back(
+             afterhours::components::get_type_id<Components>()),
+         ...);
+        return *this;
+    }
+
+    SystemAccess& chunked() {
+        chunkable = true;
+        return *this;
+    }
+
+    [[nodiscard]] bool conflicts_with(const SystemAccess& other) const;
+};
+
+// Registered as a single system, owns a handful of systems that declared
+// their access. Every tick it checks which of them want to run, orders them
+// into waves where nothing in a wave conflicts with anything else in it (and
+// a system always runs after every earlier system it conflicts with), then
+// runs each wave on the job pool.
+//
+// Like the group markers it does all its work in should_run() and returns
+// false, so afterhours never loops entities for it.
+struct ParallelSystemBatch : public afterhours::System<> {
+    struct Entry {
+        std::unique_ptr<afterhours::SystemBase> system;
+        SystemAccess access;
+    };
+
+    std::vector<Entry> entries;
+
+    void add(std::unique_ptr<afterhours::SystemBase> system,
+             SystemAccess access) {
+        entries.push_back(Entry{std::move(system), std::move(access)});
+    }
+
+    virtual bool should_run(const float dt) override;
+
+    // Wave index for each entry, nullptr marks an entry that is not running
+    // this tick and gets -1
+    [[nodiscard]] static std::vector<int> build_waves(
+        const std::vector<const SystemAccess*>& running);
+
+   private:
+    void run(afterhours::Entities& entities, float dt);
+};
@@ -2,8 +2,8 @@
 
 #include "../../../ah.h"
 #include "../../../components/has_fishing_game.h"
+#include "../../core/system_groups.h"
 #include "../../core/system_manager.h"
-#include "../../system_utilities.h"
 
 namespace system_manager {
 
@@ -14,7 +14,7 @@ struct PassTimeForActiveFishingGamesSystem
     virtual ~PassTimeForActiveFishingGamesSystem() = default;
 
     virtual bool should_run(const float) override {
-        return system_utils::should_run_inround_system();
+        return system_groups::is_active(SystemGroup::InRound);
     }
 
     virtual void for_each_with(Entity&, HasFishingGame& fishingGame,
@@ -3,8 +3,8 @@
 #include "../../../ah.h"
 #include "../../../components/can_hold_item.h"
 #include "../../../components/has_work.h"
+#include "../../core/system_groups.h"
 #include "../../core/system_manager.h"
-#include "../../system_utilities.h"
 
 namespace system_manager {
 
@@ -13,7 +13,7 @@ namespace inround {
 struct ResetEmptyWorkFurnitureSystem
     : public afterhours::System<HasWork, CanHoldItem> {
     virtual bool should_run(const float) override {
-        return system_utils::should_run_inround_system();
+        return system_groups::is_active(SystemGroup::InRound);
     }
 
     void for_each_with(Entity&, HasWork& hasWork, CanHoldItem& chi,
@@ -8,8 +8,8 @@
 #include "../../../components/is_store_spawned.h"
 #include "../../../entities/entity_helper.h"
 #include "../../../entities/entity_type.h"
+#include "../../core/system_groups.h"
 #include "../../core/system_manager.h"
-#include "../../system_utilities.h"
 
 namespace system_manager {
 
@@ -21,7 +21,7 @@ struct CartManagementSystem
     OptEntity sophie;
 
     virtual bool should_run(const float) override {
-        if (!system_utils::should_run_planning_system()) return false;
+        if (!system_groups::is_active(SystemGroup::Planning)) return false;
         sophie = EntityHelper::getNamedEntity(NamedEntity::Sophie);
         return true;
     }
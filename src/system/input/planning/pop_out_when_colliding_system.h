@@ -11,8 +11,8 @@
 #include "../../../entities/entity_helper.h"
 #include "../../../entities/entity_query.h"
 #include "../../../entities/entity_type.h"
+#include "../../core/system_groups.h"
 #include "../../core/system_manager.h"
-#include "../../system_utilities.h"
 
 namespace system_manager {
 
@@ -21,7 +21,7 @@ namespace planning {
 struct PopOutWhenCollidingSystem
     : public afterhours::System<Transform, CanHoldHandTruck, CanHoldFurniture> {
     virtual bool should_run(const float) override {
-        return system_utils::should_run_planning_system();
+        return system_groups::is_active(SystemGroup::Planning);
     }
 
     virtual void for_each_with(Entity& entity, Transform& transform,
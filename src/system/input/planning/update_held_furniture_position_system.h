@@ -4,8 +4,8 @@
 #include "../../../components/can_hold_furniture.h"
 #include "../../../components/transform.h"
 #include "../../../entities/entity_helper.h"
+#include "../../core/system_groups.h"
 #include "../../core/system_manager.h"
-#include "../../system_utilities.h"
 
 namespace system_manager {
 
@@ -14,7 +14,7 @@ namespace planning {
 struct UpdateHeldFurniturePositionSystem
     : public afterhours::System<CanHoldFurniture, Transform> {
     virtual bool should_run(const float) override {
-        return system_utils::should_run_planning_system();
+        return system_groups::is_active(SystemGroup::Planning);
     }
 
     virtual void for_each_with([[maybe_unused]] Entity& entity,
@@ -0,0 +1,176 @@
+#include "render_culling.h"
+
+#include <map>
+
+#include "../../components/has_client_id.h"
+#include "../../components/is_ai_controlled.h"
+#include "../../components/is_solid.h"
+#include "../../components/transform.h"
+#include "../../engine/tracy.h"
+#include "../../entities/entity_helper.h"
+
+static Frustum frustum;
+static system_manager::render_manager::StaticCullGrid static_cull_grid;
+static system_manager::render_manager::CullingStats current_stats;
+static system_manager::render_manager::CullingStats last_stats;
+
+namespace system_manager {
+namespace render_manager {
+
+namespace {
+BoundingBox merge_bounds(const BoundingBox& a, const BoundingBox& b) {
+    return BoundingBox{
+        vec3{fminf(a.min.x, b.min.x), fminf(a.min.y, b.min.y),
+             fminf(a.min.z, b.min.z)},
+        vec3{fmaxf(a.max.x, b.max.x), fmaxf(a.max.y, b.max.y),
+             fmaxf(a.max.z, b.max.z)},
+    };
+}
+
+BoundingBox cull_bounds(const Transform& transform) {
+    return transform.expanded_bounds({0, 0, 0});
+}
+}  // namespace
+
+bool StaticCullGrid::is_static(const Entity& entity) {
+    // Solid things that nobody drives around, held furniture is caught by
+    // the position check in try_get_visibility
+    if (entity.is_missing<IsSolid>()) return false;
+    if (entity.has<IsAIControlled>()) return false;
+    if (entity.has<HasClientID>()) return false;
+    return true;
+}
+
+void StaticCullGrid::rebuild(const afterhours::Entities& entities) {
+    TRACY_ZONE_SCOPED;
+    cells.clear();
+    entries.clear();
+
+    std::map<std::pair<int, int>, size_t> cell_lookup;
+
+    for (const auto& sp : entities) {
+        if (!sp) continue;
+        const Entity& entity = *sp;
+        if (entity.cleanup) continue;
+        if (entity.is_missing<Transform>()) continue;
+        if (!is_static(entity)) continue;
+
+        const Transform& transform = entity.get<Transform>();
+        vec3 pos = transform.raw();
+        std::pair<int, int> key = {
+            static_cast<int>(floorf(pos.x / CELL_SIZE)),
+            static_cast<int>(floorf(pos.z / CELL_SIZE)),
+        };
+
+        BoundingBox bounds = cull_bounds(transform);
+        auto it = cell_lookup.find(key);
+        size_t cell_index = 0;
+        if (it == cell_lookup.end()) {
+            cell_index = cells.size();
+            cell_lookup[key] = cell_index;
+            cells.push_back(Cell{.bounds = bounds});
+        } else {
+            cell_index = it->second;
+            cells[cell_index].bounds =
+                merge_bounds(cells[cell_index].bounds, bounds);
+        }
+
+        entries[entity.id] = Entry{.cell = cell_index, .position = pos};
+    }
+
+    dirty = false;
+    next_epoch();
+}
+
+bool StaticCullGrid::cell_visible(const Frustum& frus, Cell& cell) {
+    if (cell.epoch != epoch) {
+        cell.visible = frus.AABBoxIn(cell.bounds.min, cell.bounds.max);
+        cell.epoch = epoch;
+    }
+    return cell.visible;
+}
+
+bool StaticCullGrid::try_get_visibility(const Frustum& frus,
+                                        const Entity& entity, bool& visible,
+                                        CullingStats& stats) {
+    auto it = entries.find(entity.id);
+    if (it == entries.end()) {
+        // new static entity since the last build
+        dirty = true;
+        return false;
+    }
+
+    Entry& entry = it->second;
+    const Transform& transform = entity.get<Transform>();
+    if (!(entry.position == transform.raw())) {
+        // furniture got picked up or moved during planning
+        dirty = true;
+        return false;
+    }
+
+    if (entry.epoch == epoch) {
+        stats.cached++;
+        visible = entry.visible;
+        return true;
+    }
+
+    if (!cell_visible(frus, cells[entry.cell])) {
+        visible = false;
+    } else {
+        BoundingBox bounds = cull_bounds(transform);
+        visible = frus.AABBoxIn(bounds.min, bounds.max);
+    }
+    entry.visible = visible;
+    entry.epoch = epoch;
+    return true;
+}
+
+size_t StaticCullGrid::num_visible_cells() const {
+    size_t count = 0;
+    for (const Cell& cell : cells) {
+        if (cell.epoch == epoch && cell.visible) count++;
+    }
+    return count;
+}
+
+void start_culling_frame() {
+    current_stats.cells_total = static_cull_grid.num_cells();
+    current_stats.cells_visible = static_cull_grid.num_visible_cells();
+    last_stats = current_stats;
+    current_stats = CullingStats{};
+}
+
+void on_frame_start() {
+    bool camera_changed = frustum.fetch_data();
+
+    if (static_cull_grid.is_dirty()) {
+        static_cull_grid.rebuild(EntityHelper::get_entities());
+    } else if (camera_changed) {
+        static_cull_grid.next_epoch();
+    }
+}
+
+bool should_cull(const Entity& entity) {
+    bool visible = false;
+    bool answered = StaticCullGrid::is_static(entity) &&
+                    static_cull_grid.try_get_visibility(frustum, entity,
+                                                        visible, current_stats);
+    if (!answered) {
+        BoundingBox bounds = cull_bounds(entity.get<Transform>());
+        visible = frustum.AABBoxIn(bounds.min, bounds.max);
+    }
+
+    if (visible) {
+        current_stats.drawn++;
+    } else {
+        current_stats.culled++;
+    }
+    return !visible;
+}
+
+const CullingStats& last_culling_stats() { return last_stats; }
+
+const Frustum& current_frustum() { return frustum; }
+
+}  // namespace render_manager
+}  // namespace system_manager
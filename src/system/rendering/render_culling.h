@@ -0,0 +1,85 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "../../engine/frustum.h"
+#include "../../entities/entity.h"
+#include "../../globals.h"
+
+namespace system_manager {
+namespace render_manager {
+
+struct CullingStats {
+    size_t drawn = 0;
+    size_t culled = 0;
+    // static entities answered from the cached visible set without a
+    // frustum test this frame
+    size_t cached = 0;
+    size_t cells_visible = 0;
+    size_t cells_total = 0;
+};
+
+// Coarse grid over immovable furniture (walls, counters, etc).
+//
+// Static entities are bucketed into CELL_SIZE x CELL_SIZE cells and each
+// cell keeps the union of its members bounds. A cell that is outside the
+// frustum culls every member with one test, and members of visible cells
+// cache their own result until the camera moves again.
+//
+// Anything that does not look static (players, customers, items) is tested
+// individually every frame.
+struct StaticCullGrid {
+    static constexpr float CELL_SIZE = 4.f * TILESIZE;
+
+    // Mark the grid for rebuild on the next frame start
+    void mark_dirty() { dirty = true; }
+    [[nodiscard]] bool is_dirty() const { return dirty; }
+
+    void rebuild(const afterhours::Entities& entities);
+    // Forget every cached answer, called when the camera changes
+    void next_epoch() { epoch++; }
+
+    // Returns true if we had a valid answer for this entity,
+    // `visible` is only written in that case
+    bool try_get_visibility(const Frustum& frustum, const Entity& entity,
+                            bool& visible, CullingStats& stats);
+
+    [[nodiscard]] size_t num_cells() const { return cells.size(); }
+    [[nodiscard]] size_t num_visible_cells() const;
+
+    static bool is_static(const Entity& entity);
+
+   private:
+    struct Cell {
+        BoundingBox bounds;
+        size_t epoch = 0;
+        bool visible = false;
+    };
+
+    struct Entry {
+        size_t cell = 0;
+        vec3 position = {0, 0, 0};
+        size_t epoch = 0;
+        bool visible = false;
+    };
+
+    bool cell_visible(const Frustum& frustum, Cell& cell);
+
+    std::vector<Cell> cells;
+    std::unordered_map<EntityID, Entry> entries;
+    // starts at 1 so default constructed cells/entries are never valid
+    size_t epoch = 1;
+    bool dirty = true;
+};
+
+[[nodiscard]] bool should_cull(const Entity& entity);
+// Publishes the counts from the frame that just finished. Once per frame,
+// not per render_entities call, Map::onDraw renders in more than one pass
+void start_culling_frame();
+[[nodiscard]] const CullingStats& last_culling_stats();
+// Frustum fetched at the start of this frame
+[[nodiscard]] const Frustum& current_frustum();
+
+}  // namespace render_manager
+}  // namespace system_manager
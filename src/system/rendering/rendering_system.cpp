@@ -35,8 +35,10 @@
 #include "../core/system_manager.h"
 #include "raylib.h"
 //
-#include "../../engine/frustum.h"
 #include "../../libraries/shader_library.h"
+#include "render_culling.h"
+#include "static_geometry.h"
+#include "wall_set_tracker.h"
 
 namespace system_manager {
 
@@ -716,7 +718,7 @@ void render_trigger_area(const Entity& entity, float dt) {
             .backface = false,
             .color = WHITE,
         };
-        raylib::DrawText3D(titleConfig);
+        TextMeshCache::get().draw(titleConfig);
 
         auto text =
             fmt::format("{}/{}", ita.active_entrants(), ita.min_req_entrants());
@@ -731,7 +733,7 @@ void render_trigger_area(const Entity& entity, float dt) {
             .backface = false,
             .color = WHITE,
         };
-        raylib::DrawText3D(metaConfig);
+        TextMeshCache::get().draw(metaConfig);
     }
 
     if (ita.progress() > 0.f) {
@@ -940,7 +942,7 @@ void render_floor_marker(const Entity& entity, float) {
         .color = WHITE,
     };
 
-    raylib::DrawText3D(textConfig);
+    TextMeshCache::get().draw(textConfig);
 
     // we dont need this since the caller of render_floor_marker doesnt
     // return render_simple_normal(entity, dt);
@@ -1485,43 +1487,14 @@ bool is_some_player_near(const Entities& remote_players, vec2 spot,
     return someone_close;
 }
 
-}  // namespace render_manager
-}  // namespace system_manager
-
-#define LOG_RENDER_ENT_COUNT 0
-
-#if LOG_RENDER_ENT_COUNT
-static size_t num_ents_drawn = 0;
-#endif
-
-static Frustum frustum;
-
-namespace system_manager {
-
-namespace render_manager {
-
-void on_frame_start() {
-#if LOG_RENDER_ENT_COUNT
-    log_warn("num entities drawn: {}", num_ents_drawn);
-    num_ents_drawn = 0;
-#endif
-    frustum.fetch_data();
-}
-
-bool should_cull(const Entity& entity) {
-    auto bounds = entity.get<Transform>().expanded_bounds({0, 0, 0});
-    return !frustum.AABBoxIn(bounds.min, bounds.max);
-}
-
 void render(const Entity& entity, float dt, bool is_debug) {
-    if (is_debug) render_debug(entity, dt);
-
+    observe_for_wall_set(entity);
+    bool baked = is_covered_by_static_geometry(entity);
     if (should_cull(entity)) return;
 
-#if LOG_RENDER_ENT_COUNT
-    // rough approx :)
-    num_ents_drawn++;
-#endif
+    if (is_debug) render_debug(entity, dt);
+    // drawn as part of its buildings mesh in render_static_geometry
+    if (baked) return;
 
     render_normal(entity, dt);
     render_held_furniture_preview(entity, dt);
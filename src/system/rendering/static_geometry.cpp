@@ -0,0 +1,266 @@
+#include "static_geometry.h"
+
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <map>
+
+#include "../../ah.h"
+#include "../../components/can_be_held.h"
+#include "../../components/model_renderer.h"
+#include "../../components/simple_colored_box_renderer.h"
+#include "../../components/transform.h"
+#include "../../engine/settings.h"
+#include "../../engine/tracy.h"
+#include "../../entities/entity_helper.h"
+#include "../../libraries/shader_library.h"
+#include "render_culling.h"
+
+static system_manager::render_manager::StaticGeometryBaker static_geometry;
+
+namespace system_manager {
+namespace render_manager {
+
+namespace {
+
+constexpr std::array<BuildingType, 6> ALL_BUILDINGS = {
+    BuildingType::ModelTest, BuildingType::Lobby, BuildingType::Store,
+    BuildingType::Progression, BuildingType::Bar, BuildingType::LoadSave,
+};
+
+struct WallMeshBuffers {
+    std::vector<float> vertices;
+    std::vector<float> normals;
+    std::vector<unsigned char> colors;
+    BoundingBox bounds{vec3{1e9f, 1e9f, 1e9f}, vec3{-1e9f, -1e9f, -1e9f}};
+
+    [[nodiscard]] size_t vertex_count() const { return vertices.size() / 3; }
+
+    void add_vertex(vec3 v, vec3 n, Color c) {
+        vertices.insert(vertices.end(), {v.x, v.y, v.z});
+        normals.insert(normals.end(), {n.x, n.y, n.z});
+        colors.insert(colors.end(), {c.r, c.g, c.b, c.a});
+        bounds.min = vec3{fminf(bounds.min.x, v.x), fminf(bounds.min.y, v.y),
+                          fminf(bounds.min.z, v.z)};
+        bounds.max = vec3{fmaxf(bounds.max.x, v.x), fmaxf(bounds.max.y, v.y),
+                          fmaxf(bounds.max.z, v.z)};
+    }
+};
+
+// Same triangles as DrawCubeCustom but with the rotation and translation
+// applied on the cpu so the whole building can share one transform
+void add_box(WallMeshBuffers& buffers, vec3 position, vec3 size,
+             float front_facing_angle, Color face_color, Color base_color) {
+    const float w = size.x / 2;
+    const float h = size.y / 2;
+    const float l = size.z / 2;
+
+    const float angle = front_facing_angle * DEG2RAD;
+    const float c = cosf(angle);
+    const float s = sinf(angle);
+    // rlRotatef(angle, 0, 1, 0)
+    const auto rotate = [c, s](vec3 v) {
+        return vec3{v.x * c + v.z * s, v.y, -v.x * s + v.z * c};
+    };
+
+    const auto face = [&](vec3 normal, Color color,
+                          const std::array<vec3, 6>& corners) {
+        vec3 n = rotate(normal);
+        for (const vec3& corner : corners) {
+            buffers.add_vertex(position + rotate(corner), n, color);
+        }
+    };
+
+    // Front
+    face({0, 0, 1}, face_color,
+         {vec3{-w, -h, l}, vec3{w, -h, l}, vec3{-w, h, l},  //
+          vec3{w, h, l}, vec3{-w, h, l}, vec3{w, -h, l}});
+    // Back
+    face({0, 0, -1}, base_color,
+         {vec3{-w, -h, -l}, vec3{-w, h, -l}, vec3{w, -h, -l},  //
+          vec3{w, h, -l}, vec3{w, -h, -l}, vec3{-w, h, -l}});
+    // Top
+    face({0, 1, 0}, base_color,
+         {vec3{-w, h, -l}, vec3{-w, h, l}, vec3{w, h, l},  //
+          vec3{w, h, -l}, vec3{-w, h, -l}, vec3{w, h, l}});
+    // Bottom
+    face({0, -1, 0}, base_color,
+         {vec3{-w, -h, -l}, vec3{w, -h, l}, vec3{-w, -h, l},  //
+          vec3{w, -h, -l}, vec3{w, -h, l}, vec3{-w, -h, -l}});
+    // Right
+    face({1, 0, 0}, base_color,
+         {vec3{w, -h, -l}, vec3{w, h, -l}, vec3{w, h, l},  //
+          vec3{w, -h, l}, vec3{w, -h, -l}, vec3{w, h, l}});
+    // Left
+    face({-1, 0, 0}, base_color,
+         {vec3{-w, -h, -l}, vec3{-w, h, l}, vec3{-w, h, -l},  //
+          vec3{-w, -h, l}, vec3{-w, h, l}, vec3{-w, -h, -l}});
+}
+
+template<typename T>
+T* copy_to_raylib(const std::vector<T>& data) {
+    T* out = static_cast<T*>(
+        raylib::MemAlloc(static_cast<unsigned int>(sizeof(T) * data.size())));
+    std::memcpy(out, data.data(), sizeof(T) * data.size());
+    return out;
+}
+
+Color valid_or_pink(Color color) {
+    return afterhours::colors::is_empty(color) ? PINK : color;
+}
+
+// -1 for walls that dont belong to any building (bar map walls etc)
+int building_index_for(vec2 position) {
+    for (size_t i = 0; i < ALL_BUILDINGS.size(); i++) {
+        if (get_building(ALL_BUILDINGS[i]).is_inside(position)) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+}  // namespace
+
+bool StaticGeometryBaker::is_bakeable(const Entity& entity) {
+    if (!check_type(entity, EntityType::Wall)) return false;
+    if (entity.is_missing<Transform>()) return false;
+    if (entity.is_missing<SimpleColoredBoxRenderer>()) return false;
+    // make_furniture adds one when there is a wall model, draw that instead
+    if (entity.has<ModelRenderer>()) return false;
+    // anything you can pick up can move
+    if (entity.has<CanBeHeld>()) return false;
+    return true;
+}
+
+bool StaticGeometryBaker::covers(const Entity& entity) {
+    if (!is_bakeable(entity)) return false;
+    walls_seen++;
+
+    auto it = baked_positions.find(entity.id);
+    if (it == baked_positions.end() ||
+        !(it->second == entity.get<Transform>().raw())) {
+        dirty = true;
+        return false;
+    }
+    return true;
+}
+
+void StaticGeometryBaker::rebuild(const afterhours::Entities& entities) {
+    TRACY_ZONE_SCOPED;
+    unload_meshes();
+
+    // ordered so the mesh order is stable between rebuilds
+    std::map<int, WallMeshBuffers> buffers_by_building;
+
+    for (const auto& sp : entities) {
+        if (!sp) continue;
+        const Entity& entity = *sp;
+        if (entity.cleanup) continue;
+        if (!is_bakeable(entity)) continue;
+
+        const Transform& transform = entity.get<Transform>();
+        const SimpleColoredBoxRenderer& renderer =
+            entity.get<SimpleColoredBoxRenderer>();
+
+        WallMeshBuffers& buffers =
+            buffers_by_building[building_index_for(transform.as2())];
+        add_box(buffers, transform.raw() + transform.viz_offset(),
+                transform.size(), transform.facing,
+                valid_or_pink(renderer.face()), valid_or_pink(renderer.base()));
+
+        baked_positions[entity.id] = transform.raw();
+    }
+
+    for (const auto& [index, buffers] : buffers_by_building) {
+        if (buffers.vertex_count() == 0) continue;
+
+        BakedMesh baked;
+        if (index >= 0) baked.building = ALL_BUILDINGS[index];
+        baked.bounds = buffers.bounds;
+
+        raylib::Mesh& mesh = baked.mesh;
+        mesh.vertexCount = static_cast<int>(buffers.vertex_count());
+        mesh.triangleCount = mesh.vertexCount / 3;
+        mesh.vertices = copy_to_raylib(buffers.vertices);
+        mesh.normals = copy_to_raylib(buffers.normals);
+        mesh.colors = copy_to_raylib(buffers.colors);
+        raylib::UploadMesh(&mesh, false);
+
+        meshes.push_back(baked);
+    }
+
+    dirty = false;
+    _stats.walls = baked_positions.size();
+    _stats.meshes = meshes.size();
+    _stats.rebuilds++;
+}
+
+void StaticGeometryBaker::draw(const Frustum& frustum) {
+    // every wall we baked should have been seen exactly once last frame,
+    // fewer means walls were deleted (map regenerated / reloaded)
+    if (walls_seen != baked_positions.size()) dirty = true;
+    walls_seen = 0;
+
+    if (dirty) rebuild(EntityHelper::get_entities());
+
+    _stats.meshes_drawn = 0;
+    if (meshes.empty()) return;
+
+    if (!material.has_value()) {
+        material = raylib::LoadMaterialDefault();
+    }
+
+    // Match whatever the immediate mode walls would have been drawn with
+    raylib::Shader shader{};
+    if (Settings::get().data.enable_lighting) {
+        shader = ShaderLibrary::get().get("lighting");
+    } else {
+        shader.id = raylib::rlGetShaderIdDefault();
+        shader.locs = raylib::rlGetShaderLocsDefault();
+    }
+    material->shader = shader;
+
+    for (const BakedMesh& baked : meshes) {
+        if (!frustum.AABBoxIn(baked.bounds.min, baked.bounds.max)) continue;
+        raylib::DrawMesh(baked.mesh, *material, raylib::MatrixIdentity());
+        _stats.meshes_drawn++;
+    }
+}
+
+void StaticGeometryBaker::unload_meshes() {
+    for (BakedMesh& baked : meshes) {
+        raylib::UnloadMesh(baked.mesh);
+    }
+    meshes.clear();
+    baked_positions.clear();
+    _stats.walls = 0;
+    _stats.meshes = 0;
+}
+
+void StaticGeometryBaker::unload_all() {
+    unload_meshes();
+    // The material only owns its map array, the shader belongs to the
+    // shader library (or rlgl) so UnloadMaterial would free too much
+    if (material.has_value()) {
+        raylib::MemFree(material->maps);
+        material.reset();
+    }
+}
+
+void render_static_geometry() {
+    TRACY_ZONE_SCOPED;
+    static_geometry.draw(current_frustum());
+}
+
+bool is_covered_by_static_geometry(const Entity& entity) {
+    return static_geometry.covers(entity);
+}
+
+const StaticGeometryStats& static_geometry_stats() {
+    return static_geometry.stats();
+}
+
+void unload_static_geometry() { static_geometry.unload_all(); }
+
+}  // namespace render_manager
+}  // namespace system_manager
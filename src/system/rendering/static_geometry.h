@@ -0,0 +1,77 @@
+#pragma once
+
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "../../building_locations.h"
+#include "../../engine/frustum.h"
+#include "../../entities/entity.h"
+
+namespace system_manager {
+namespace render_manager {
+
+struct StaticGeometryStats {
+    size_t walls = 0;
+    size_t meshes = 0;
+    size_t meshes_drawn = 0;
+    size_t rebuilds = 0;
+};
+
+// Walls never move once the map is generated, so instead of pushing 36
+// immediate mode vertices per wall every frame we bake every wall of a
+// building into one mesh and draw that with a single DrawMesh.
+//
+// Walls use vertex colors so they all share one material, which means we end
+// up with one mesh per building (plus one for anything outside a building).
+//
+// The entities are untouched and still used for collision, pathing and the
+// lighting occluders, the renderer just skips them once they are baked.
+//
+// The client gets a fresh copy of the world every snapshot, so rather than
+// hooking map generation we notice when the set of walls we see while
+// rendering stops matching what we baked (new ids, a wall moved, or walls
+// went away) and rebuild on the next frame.
+struct StaticGeometryBaker {
+    static bool is_bakeable(const Entity& entity);
+
+    // Called for every rendered entity, returns true if this entity is
+    // already part of a baked mesh and should not be drawn on its own
+    [[nodiscard]] bool covers(const Entity& entity);
+
+    // Checks what we saw last frame, rebuilds if needed and then draws
+    // every baked mesh inside the frustum. Call once per frame.
+    void draw(const Frustum& frustum);
+
+    void rebuild(const afterhours::Entities& entities);
+    void unload_all();
+
+    [[nodiscard]] const StaticGeometryStats& stats() const { return _stats; }
+
+   private:
+    struct BakedMesh {
+        std::optional<BuildingType> building;
+        raylib::Mesh mesh{};
+        BoundingBox bounds{};
+    };
+
+    void unload_meshes();
+
+    std::vector<BakedMesh> meshes;
+    std::unordered_map<EntityID, vec3> baked_positions;
+    std::optional<raylib::Material> material;
+
+    size_t walls_seen = 0;
+    bool dirty = false;
+    StaticGeometryStats _stats;
+};
+
+// Draws the baked walls, the map calls this once per frame between the remote
+// player and world render passes
+void render_static_geometry();
+[[nodiscard]] bool is_covered_by_static_geometry(const Entity& entity);
+[[nodiscard]] const StaticGeometryStats& static_geometry_stats();
+void unload_static_geometry();
+
+}  // namespace render_manager
+}  // namespace system_manager
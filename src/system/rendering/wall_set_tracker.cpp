@@ -0,0 +1,46 @@
+#include "wall_set_tracker.h"
+
+#include "../../components/transform.h"
+
+static system_manager::render_manager::WallSetTracker wall_set;
+
+namespace system_manager {
+namespace render_manager {
+
+void WallSetTracker::observe(const Entity& entity) {
+    if (!check_type(entity, EntityType::Wall)) return;
+    if (entity.is_missing<Transform>()) return;
+
+    Seen& seen = walls[entity.id];
+    // Also catches walls we had never seen, those start at frame 0
+    if (seen.frame == 0 || !(seen.position == entity.get<Transform>().raw())) {
+        changed = true;
+    }
+    // Counted once even if two passes see it
+    if (seen.frame != frame) seen_this_frame++;
+    seen.position = entity.get<Transform>().raw();
+    seen.frame = frame;
+}
+
+void WallSetTracker::end_frame() {
+    // Fewer walls than we know about means some went away
+    if (seen_this_frame != walls.size()) {
+        std::erase_if(walls,
+                      [&](const auto& kv) { return kv.second.frame != frame; });
+        changed = true;
+    }
+    if (changed) _generation++;
+
+    changed = false;
+    seen_this_frame = 0;
+    frame++;
+}
+
+void observe_for_wall_set(const Entity& entity) { wall_set.observe(entity); }
+
+void update_wall_set() { wall_set.end_frame(); }
+
+size_t wall_set_generation() { return wall_set.generation(); }
+
+}  // namespace render_manager
+}  // namespace system_manager
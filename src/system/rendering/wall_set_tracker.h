@@ -0,0 +1,45 @@
+#pragma once
+
+#include <unordered_map>
+
+#include "../../entities/entity.h"
+
+namespace system_manager {
+namespace render_manager {
+
+// Notices when the walls change (added, removed or moved) so things derived
+// from them, like the bar's light rect, can be redone only then.
+//
+// The client gets a fresh copy of the world every snapshot, so there is no
+// map generation event to hook on that side. Instead every wall is looked at
+// as the world render pass walks past it, which happens anyway, whether or
+// not it ends up baked or drawn with a model.
+struct WallSetTracker {
+    // Called for every entity in the world render pass, before culling
+    void observe(const Entity& entity);
+    // Once per frame, after the frame the walls were observed in
+    void end_frame();
+
+    // Bumped every time the set of walls changed, 0 means none seen yet
+    [[nodiscard]] size_t generation() const { return _generation; }
+
+   private:
+    struct Seen {
+        vec3 position{};
+        size_t frame = 0;
+    };
+
+    std::unordered_map<EntityID, Seen> walls;
+    size_t frame = 1;
+    size_t seen_this_frame = 0;
+    bool changed = false;
+    size_t _generation = 0;
+};
+
+void observe_for_wall_set(const Entity& entity);
+// Map::onDraw calls this once at the start of every frame
+void update_wall_set();
+[[nodiscard]] size_t wall_set_generation();
+
+}  // namespace render_manager
+}  // namespace system_manager
@@ -1,5 +1,6 @@
 // System includes - each system is in its own header file to improve build
 // times
+#include "../core/system_groups.h"
 #include "../core/system_manager.h"
 #include "../trigger/trigger_area_systems.h"
 #include "clear_floor_markers_system.h"
@@ -26,41 +27,25 @@ void SystemManager::register_sixtyfps_systems() {
     // lightweight. The original ran at 60fps (when timePassed >= 0.016f), but
     // running every frame ensures trigger areas and other interactions feel
     // more responsive.
+    system_groups::GroupRegistrar group(systems, SystemGroup::SixtyFps);
 
-    systems.register_update_system(
-        std::make_unique<system_manager::ClearAllFloorMarkersSystem>());
-    systems.register_update_system(
-        std::make_unique<system_manager::MarkItemInFloorAreaSystem>());
-    system_manager::register_trigger_area_systems(systems);
-    systems.register_update_system(
-        std::make_unique<system_manager::ProcessNuxUpdatesSystem>());
-    systems.register_update_system(
-        std::make_unique<
-            system_manager::UpdateCharacterModelFromIndexSystem>());
-    systems.register_update_system(
-        std::make_unique<system_manager::ProcessSodaFountainSystem>());
-    systems.register_update_system(
-        std::make_unique<system_manager::ProcessTrashSystem>());
-    systems.register_update_system(
-        std::make_unique<
-            system_manager::DeleteCustomersWhenLeavingInroundSystem>());
-    systems.register_update_system(
-        std::make_unique<system_manager::TransformSnapperSystem>());
-    systems.register_update_system(
-        std::make_unique<system_manager::ResetHighlightedSystem>());
-    systems.register_update_system(
-        std::make_unique<system_manager::RefetchDynamicModelNamesSystem>());
-    systems.register_update_system(
-        std::make_unique<system_manager::HighlightFacingFurnitureSystem>());
-    systems.register_update_system(
-        std::make_unique<system_manager::ShowMinimapWhenHighlightedSystem>());
-    systems.register_update_system(
-        std::make_unique<system_manager::UpdateHeldPositionSystem<CanHoldItem>>());
-    systems.register_update_system(
-        std::make_unique<system_manager::UpdateHeldPositionSystem<CanHoldHandTruck>>());
-    systems.register_update_system(
-        std::make_unique<
-            system_manager::UpdateVisualsForSettingsChangerSystem>());
-    systems.register_update_system(
-        std::make_unique<system_manager::ProcessSquirterSystem>());
+    group.add<system_manager::ClearAllFloorMarkersSystem>();
+    group.add<system_manager::MarkItemInFloorAreaSystem>();
+    group.add_timed("trigger_area_systems", [&]() {
+        system_manager::register_trigger_area_systems(systems);
+    });
+    group.add<system_manager::ProcessNuxUpdatesSystem>();
+    group.add<system_manager::UpdateCharacterModelFromIndexSystem>();
+    group.add<system_manager::ProcessSodaFountainSystem>();
+    group.add<system_manager::ProcessTrashSystem>();
+    group.add<system_manager::DeleteCustomersWhenLeavingInroundSystem>();
+    group.add<system_manager::TransformSnapperSystem>();
+    group.add<system_manager::ResetHighlightedSystem>();
+    group.add<system_manager::RefetchDynamicModelNamesSystem>();
+    group.add<system_manager::HighlightFacingFurnitureSystem>();
+    group.add<system_manager::ShowMinimapWhenHighlightedSystem>();
+    group.add<system_manager::UpdateHeldPositionSystem<CanHoldItem>>();
+    group.add<system_manager::UpdateHeldPositionSystem<CanHoldHandTruck>>();
+    group.add<system_manager::UpdateVisualsForSettingsChangerSystem>();
+    group.add<system_manager::ProcessSquirterSystem>();
 }
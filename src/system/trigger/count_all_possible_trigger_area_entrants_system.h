@@ -2,7 +2,6 @@
 
 #include "../../ah.h"
 #include "../../components/is_trigger_area.h"
-#include "../../entities/entity_query.h"
 #include "../core/system_manager.h"
 
 namespace system_manager {
@@ -14,9 +13,7 @@ struct CountAllPossibleTriggerAreaEntrantsSystem
     virtual bool should_run(const float) override { return true; }
 
     virtual void once(float) override {
-        count = static_cast<int>(EQ(SystemManager::get().oldAll)
-                                     .whereType(EntityType::Player)
-                                     .gen_count());
+        count = static_cast<int>(SystemManager::get().player_transforms.size());
     }
 
     virtual void for_each_with(Entity&, IsTriggerArea& ita, float) override {
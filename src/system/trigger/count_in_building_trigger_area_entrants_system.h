@@ -5,7 +5,6 @@
 #include "../../ah.h"
 #include "../../building_locations.h"
 #include "../../components/is_trigger_area.h"
-#include "../../entities/entity_query.h"
 #include "../core/system_manager.h"
 
 namespace system_manager {
@@ -19,10 +18,9 @@ struct CountInBuildingTriggerAreaEntrantsSystem
     virtual void once(float) override {
         for (BuildingType type : magic_enum::enum_values<BuildingType>()) {
             const Building& b = get_building(type);
-            counts[type] = static_cast<int>(EQ(SystemManager::get().oldAll)
-                                                .whereType(EntityType::Player)
-                                                .whereInside(b.min(), b.max())
-                                                .gen_count());
+            counts[type] = static_cast<int>(
+                SystemManager::get().player_transforms.count_inside(b.min(),
+                                                                    b.max()));
         }
     }
 
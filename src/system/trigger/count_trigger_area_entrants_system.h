@@ -3,7 +3,6 @@
 #include "../../ah.h"
 #include "../../components/is_trigger_area.h"
 #include "../../components/transform.h"
-#include "../../entities/entity_query.h"
 #include "../core/system_manager.h"
 
 namespace system_manager {
@@ -15,11 +14,8 @@ struct CountTriggerAreaEntrantsSystem
     virtual void for_each_with(Entity& entity, IsTriggerArea& ita,
                                float) override {
         size_t count =
-            EQ(SystemManager::get().oldAll)
-                .whereType(EntityType::Player)
-                .whereCollides(
-                    entity.get<Transform>().expanded_bounds({0, TILESIZE, 0}))
-                .gen_count();
+            SystemManager::get().player_transforms.count_colliding(
+                entity.get<Transform>().expanded_bounds({0, TILESIZE, 0}));
 
         ita.update_entrants(static_cast<int>(count));
     }
@@ -15,10 +15,14 @@
 #include "lerp_test.h"
 #include "rect_split_tests.h"
 #include "size_ents.h"
+#include "test_crowd_separation.h"
 #include "test_entity_serialization.h"
+#include "test_lighting_runtime.h"
 #include "test_map_playability.h"
 #include "test_pathing.h"
 #include "test_replay_validation_smoke.h"
+#include "test_sim_lod.h"
+#include "test_system_scheduler.h"
 #include "test_ui_widget.h"
 
 namespace tests {
@@ -76,6 +80,10 @@ inline void run_all() {
     size_test();
     test_rect_split();
     test_entity_serialization();
+    test_lighting_runtime();
+    test_system_scheduler();
+    test_crowd_separation();
+    test_sim_lod();
     test_replay_validation_smoke();
 
     // back to default , preload will set it as well
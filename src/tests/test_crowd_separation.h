@@ -0,0 +1,49 @@
+#pragma once
+
+#include "../system/ai/crowd_separation.h"
+
+namespace tests {
+
+inline void test_crowd_separation_pushes_apart() {
+    CrowdSeparation crowd;
+    crowd.add(1, vec2{0.f, 0.f});
+    crowd.add(2, vec2{0.2f, 0.f});
+    crowd.solve(0.1f);
+
+    M_TEST_T(crowd.push_x[0] < 0.f, "left one should move left");
+    M_TEST_T(crowd.push_x[1] > 0.f, "right one should move right");
+    M_TEST_T(crowd.push_z[0] == 0.f && crowd.push_z[1] == 0.f,
+             "nothing pushes along z");
+    M_TEST_T(-crowd.push_x[0] <= crowd.push_speed * 0.1f,
+             "push is capped by push_speed");
+}
+
+inline void test_crowd_separation_leaves_lines_alone() {
+    // Queue spots are a tile apart
+    CrowdSeparation crowd;
+    for (int i = 0; i < 5; i++) {
+        crowd.add(i, vec2{0.f, (float) i});
+    }
+    crowd.solve(0.1f);
+    for (size_t i = 0; i < crowd.size(); i++) {
+        M_TEST_T(crowd.push_x[i] == 0.f && crowd.push_z[i] == 0.f,
+                 "customers a tile apart should not be pushed");
+    }
+}
+
+inline void test_crowd_separation_stacked() {
+    CrowdSeparation crowd;
+    crowd.add(1, vec2{3.f, 3.f});
+    crowd.add(2, vec2{3.f, 3.f});
+    crowd.solve(0.1f);
+    M_TEST_T(crowd.push_x[0] != crowd.push_x[1],
+             "customers on the same spot should split up");
+}
+
+inline void test_crowd_separation() {
+    test_crowd_separation_pushes_apart();
+    test_crowd_separation_leaves_lines_alone();
+    test_crowd_separation_stacked();
+}
+
+}  // namespace tests
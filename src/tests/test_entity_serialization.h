@@ -144,10 +144,66 @@ inline void test_entity_serialization_all_tags() {
     }
 }
 
+inline void test_entity_serialization_reused_decode() {
+    // Decoding into the same entity again hands its components back to the
+    // decode pool and pulls them out for the next record, so nothing from the
+    // first record may survive into the second
+    auto first = std::make_shared<Entity>();
+    first->entity_type = static_cast<int>(EntityType::Item);
+    first->addComponent<Transform>();
+    first->get<Transform>().update(vec3{1.0f, 2.0f, 3.0f});
+    first->addComponent<HasName>();
+    first->get<HasName>().name = "First";
+    first->addComponent<IsItem>();
+
+    // No HasName or IsItem this time
+    auto second = std::make_shared<Entity>();
+    second->entity_type = static_cast<int>(EntityType::Item);
+    second->addComponent<Transform>();
+    second->get<Transform>().update(vec3{4.0f, 5.0f, 6.0f});
+
+    // HasName comes back, out of the pool this time
+    auto third = std::make_shared<Entity>();
+    third->entity_type = static_cast<int>(EntityType::Item);
+    third->addComponent<HasName>();
+    third->get<HasName>().name = "Third";
+
+    auto decoded = std::make_shared<Entity>();
+
+    network::deserialize_to_entity(decoded.get(),
+                                   network::serialize_to_entity(first.get()));
+    VALIDATE(decoded->id == first->id, "first decode id should match");
+    VALIDATE(decoded->has<HasName>() && decoded->has<IsItem>(),
+             "first decode should have HasName and IsItem");
+
+    network::deserialize_to_entity(decoded.get(),
+                                   network::serialize_to_entity(second.get()));
+    VALIDATE(decoded->id == second->id, "second decode id should match");
+    VALIDATE(!decoded->has<HasName>(),
+             "HasName should be gone after decoding a record without it");
+    VALIDATE(!decoded->has<IsItem>(),
+             "IsItem should be gone after decoding a record without it");
+    VALIDATE(decoded->has<Transform>(),
+             "Transform should exist after the second decode");
+    const vec3 pos = decoded->get<Transform>().position;
+    VALIDATE(pos.x == 4.0f && pos.y == 5.0f && pos.z == 6.0f,
+             "Transform should hold the second record's position");
+
+    network::deserialize_to_entity(decoded.get(),
+                                   network::serialize_to_entity(third.get()));
+    VALIDATE(!decoded->has<Transform>(),
+             "Transform should be gone after the third decode");
+    VALIDATE(decoded->has<HasName>(),
+             "HasName should exist after the third decode");
+    VALIDATE(decoded->get<HasName>().name == "Third",
+             "reused HasName should hold the third record's name");
+}
+
 inline void test_entity_serialization() {
     test_entity_serialization_roundtrip();
     test_entity_serialization_empty_tags();
     test_entity_serialization_all_tags();
+    test_entity_serialization_reused_decode();
 }
 
 }  // namespace tests
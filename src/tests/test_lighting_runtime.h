@@ -0,0 +1,81 @@
+#pragma once
+
+#include "../building_locations.h"
+#include "../lighting_runtime.h"
+
+namespace tests {
+
+inline bool light_inside_rect(const lighting::LightList& list, int light,
+                              const vec4& rect) {
+    vec4 p = list.pos_radius(light);
+    return p.x >= rect.x && p.x <= rect.z && p.z >= rect.y && p.z <= rect.w;
+}
+
+inline void test_lighting_bar_rect() {
+    vec4 fallback = lighting::bar_light_rect({});
+    M_TEST_EQ(fallback.x, BAR_BUILDING.min().x, "no walls uses the building");
+    M_TEST_EQ(fallback.w, BAR_BUILDING.max().y, "no walls uses the building");
+
+    vec4 room =
+        lighting::bar_light_rect({vec2{-20, 0}, vec2{-10, 0}, vec2{-20, 8}});
+    M_TEST_EQ(room.x, -19, "should move inside the walls");
+    M_TEST_EQ(room.y, 1, "should move inside the walls");
+    M_TEST_EQ(room.z, -11, "should move inside the walls");
+    M_TEST_EQ(room.w, 7, "should move inside the walls");
+
+    vec4 line = lighting::bar_light_rect({vec2{-20, 0}, vec2{-10, 0}});
+    M_TEST_EQ(line.y, BAR_BUILDING.min().y, "a single wall is not a room");
+}
+
+inline void test_lighting_day_lights() {
+    vec4 bar_rect = lighting::bar_light_rect({});
+    lighting::LightList list = lighting::gather_indoor_lights(bar_rect, false);
+
+    M_TEST_EQ(list.rect_count, lighting::NUM_BUILDINGS, "one rect per building");
+    M_TEST_EQ(list.light_count,
+              lighting::NUM_BUILDINGS * lighting::LIGHTS_PER_BUILDING,
+              "every building is lit during the day");
+
+    for (int b = 0; b < list.rect_count; b++) {
+        const lighting::LightList::Range& range = list.ranges[b];
+        M_TEST_EQ(range.count, lighting::LIGHTS_PER_BUILDING,
+                  "each building gets the same number of lights");
+        for (int i = range.first; i < range.first + range.count; i++) {
+            M_TEST_T(light_inside_rect(list, i, list.rects[b]),
+                     "lights should stay inside their building");
+        }
+    }
+
+    lighting::LightList again = lighting::gather_indoor_lights(bar_rect, false);
+    M_TEST_EQ(list.pos_radius(7).x, again.pos_radius(7).x,
+              "gathering should be deterministic");
+}
+
+inline void test_lighting_night_lights() {
+    vec4 bar_rect = lighting::bar_light_rect({});
+    lighting::LightList list = lighting::gather_indoor_lights(bar_rect, true);
+
+    M_TEST_EQ(list.light_count, lighting::NIGHT_BAR_LIGHTS,
+              "only the bar is lit at night");
+    for (int b = 0; b < list.rect_count; b++) {
+        int expected =
+            b == lighting::BAR_BUILDING_INDEX ? lighting::NIGHT_BAR_LIGHTS : 0;
+        M_TEST_EQ(list.ranges[b].count, expected,
+                  "closed buildings should have no lights at night");
+    }
+
+    const lighting::LightList::Range& bar =
+        list.ranges[lighting::BAR_BUILDING_INDEX];
+    for (int i = bar.first; i < bar.first + bar.count; i++) {
+        M_TEST_T(light_inside_rect(list, i, bar_rect),
+                 "bar lights should stay inside the bar");
+    }
+}
+
+inline void test_lighting_runtime() {
+    test_lighting_bar_rect();
+    test_lighting_day_lights();
+    test_lighting_night_lights();
+}
+
+}  // namespace tests
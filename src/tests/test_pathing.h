@@ -1,5 +1,9 @@
 
+#include "../engine/hierarchical_path.h"
+#include "../engine/obstacle_grid.h"
+#include "../engine/path_cache.h"
 #include "../engine/pathfinder.h"
+#include "../engine/walkable_regions.h"
 #include "../entities/entity.h"
 #include "../entities/entity_helper.h"
 #include "../map_generation/map_generation.h"
@@ -215,6 +219,177 @@ wwwwwwwwwwwwwww
     teardown();
 }
 
+inline void test_obstacle_grid_matches_scan() {
+    auto [z, x] = setup(R"(
+wwwwwwwwwwwwwww
+w...w...w...wxw
+w.w.w.w.w.w.w.w
+wzw...w.w.w...w
+wwwwwwwwwwwwwww
+    )");
+
+    std::vector<vec2> obstacles;
+    for (const auto& entity : ents) {
+        if (entity.is_missing<IsSolid>()) continue;
+        obstacles.push_back(entity.get<Transform>().as2());
+    }
+
+    DoubleBufferedObstacleGrid grids;
+    VALIDATE(grids.publish_if_changed(obstacles), "first publish should flip");
+    VALIDATE(!grids.publish_if_changed(obstacles),
+             "same obstacles should not republish");
+    VALIDATE(grids.generation() == 1, "should be on the first generation");
+
+    {
+        DoubleBufferedObstacleGrid::ReadLock grid(grids);
+        for (int i = -2; i < 20; i++) {
+            for (int j = -2; j < 10; j++) {
+                vec2 pos{(float) i, (float) j};
+                VALIDATE(grid->is_walkable(pos) == canvisit(pos),
+                         "grid should match scanning every obstacle");
+            }
+        }
+    }
+
+    obstacles.pop_back();
+    VALIDATE(grids.publish_if_changed(obstacles),
+             "removing an obstacle should republish");
+    VALIDATE(grids.generation() == 2, "should be on the second generation");
+    //
+    teardown();
+}
+
+inline void test_regions_match_bfs() {
+    const std::vector<std::string> maps = {
+        "z..w..x",
+        R"(
+www
+wzw....x.
+www
+    )",
+        R"(
+www
+wxw....z.
+www
+    )",
+        R"(
+wwwwwwwwwwwwwww
+w...wwwwwwwwwww
+w.x.wwwwwwwwwww
+w.............w
+wwwwwwwwwwwww.w
+w...w...w...w.w
+w.w.w.w.w.w.w.w
+wzw...w...w...w
+wwwwwwwwwwwwwww
+)",
+        R"(
+wwwwwwwwwwwwwww
+w...w...w...wxw
+w.w.w.w.w.w.w.w
+w.w.w.w.w.w.w.w
+w.w.w.w.w.w.w.w
+wzw...w.w.w...w
+wwwwwwwwwwwwwww
+    )",
+    };
+
+    for (const std::string& map : maps) {
+        auto [z, x] = setup(map);
+
+        std::vector<vec2> obstacles;
+        for (const auto& entity : ents) {
+            if (entity.is_missing<IsSolid>()) continue;
+            obstacles.push_back(entity.get<Transform>().as2());
+        }
+        WalkableRegions regions;
+        VALIDATE(regions.update_if_changed(obstacles), "first build labels");
+        VALIDATE(!regions.update_if_changed(obstacles),
+                 "same obstacles should not relabel");
+
+        VALIDATE(regions.can_reach(z, x) == !p(z, x).empty(),
+                 "regions should agree with the bfs");
+        VALIDATE(regions.can_reach(x, z) == !p(x, z).empty(),
+                 "regions should agree with the bfs");
+        teardown();
+    }
+}
+
+inline void test_hierarchical_long_path() {
+    // A wall too long for the bfs to get around
+    std::vector<vec2> obstacles;
+    for (int y = -60; y < 60; y++) obstacles.push_back(vec2{15.f, (float) y});
+    ObstacleGrid grid;
+    grid.rebuild(obstacles, 1);
+    const auto is_walkable = [&grid](const vec2& pos) {
+        return grid.is_walkable(pos);
+    };
+
+    vec2 start{3.f, 2.f};
+    vec2 end{27.f, 2.f};
+    VALIDATE(bfs::find_path(start, end, is_walkable).empty(),
+             "the bfs should give up before getting around");
+
+    HierarchicalPathfinder hierarchical;
+    auto path = hierarchical.find_path(grid, start, end);
+    VALIDATE(!path.empty(), "should find the way around the wall");
+    VALIDATE(path.back() == end, "path should end on the goal");
+    vec2 prev = start;
+    for (const vec2& step : path) {
+        VALIDATE(is_walkable(step), "every step should be walkable");
+        VALIDATE(std::abs(step.x - prev.x) <= TILESIZE &&
+                     std::abs(step.y - prev.y) <= TILESIZE,
+                 "every step should be to a neighboring tile");
+        prev = step;
+    }
+
+    // Boxing in the goal cuts it off completely
+    for (int x = 26; x <= 28; x++) {
+        for (int y = 1; y <= 3; y++) {
+            if (x == 27 && y == 2) continue;
+            obstacles.push_back(vec2{(float) x, (float) y});
+        }
+    }
+    grid.rebuild(obstacles, 2);
+    VALIDATE(hierarchical.find_path(grid, start, end).empty(),
+             "boxed in goal should have no path");
+}
+
+inline void test_path_cache() {
+    PathCache cache;
+    vec2 start{0.f, 0.f};
+    vec2 end{5.f, 0.f};
+    CompactPath path = CompactPath::from_steps(
+        {{1.f, 0.f}, {2.f, 0.f}, {3.f, 0.f}, {4.f, 0.f}, end});
+
+    VALIDATE(!cache.find(start, end, 1).has_value(), "empty cache should miss");
+    cache.insert(start, end, 1, path);
+
+    auto hit = cache.find(vec2{0.2f, -0.1f}, vec2{5.1f, 0.f}, 1);
+    VALIDATE(hit.has_value(), "same tiles should hit");
+    VALIDATE(hit->size() == path.size(), "should get the stored path back");
+    VALIDATE(hit->back() == (vec2{5.1f, 0.f}), "should end where we asked");
+
+    cache.insert(start, vec2{9.f, 9.f}, 1, CompactPath{});
+    auto no_path = cache.find(start, vec2{9.f, 9.f}, 1);
+    VALIDATE(no_path.has_value() && no_path->empty(),
+             "failed searches should be remembered too");
+
+    VALIDATE(!cache.find(start, end, 2).has_value(),
+             "new obstacle grid should drop everything");
+    cache.insert(start, end, 1, path);
+    VALIDATE(!cache.find(start, end, 2).has_value(),
+             "paths from an old grid should not be stored");
+
+    for (int i = 0; i <= (int) PathCache::CAPACITY; i++) {
+        cache.insert(vec2{(float) i, 0.f}, end, 2, path);
+    }
+    VALIDATE(!cache.find(vec2{0.f, 0.f}, end, 2).has_value(),
+             "oldest entry should have been evicted");
+    VALIDATE(cache.find(vec2{1.f, 0.f}, end, 2).has_value(),
+             "newer entries should still be there");
+}
+
 }  // namespace test
    //
 inline void test_all_pathing() {
@@ -228,6 +403,10 @@ inline void test_all_pathing() {
     test_clear_path_surround_one_exit();
     test_maze_path_exists();
     test_maze_path_doesnt_exist();
+    test_obstacle_grid_matches_scan();
+    test_regions_match_bfs();
+    test_hierarchical_long_path();
+    test_path_cache();
 
     test::ents.clear();
 }
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cmath>
+
+#include "../components/has_patience.h"
+#include "../components/sim_lod_info.h"
+
+namespace tests {
+
+inline void test_sim_lod_reduced_rate_keeps_time() {
+    constexpr float dt = 1.f / 120.f;
+    SimLODInfo lod;
+    lod.reduce(0);
+
+    int runs = 0;
+    float simulated = 0.f;
+    for (int i = 0; i < SimLODInfo::REDUCED_INTERVAL * 10; i++) {
+        std::optional<float> step = lod.step(dt);
+        if (!step) continue;
+        runs++;
+        simulated += step.value();
+    }
+    M_TEST_EQ(runs, 10, "reduced rate runs once per interval");
+    M_TEST_T(std::abs(simulated - dt * SimLODInfo::REDUCED_INTERVAL * 10) <
+                 0.0001f,
+             "no time is lost while skipping ticks");
+
+    (void) lod.step(dt);
+    lod.promote();
+    std::optional<float> step = lod.step(dt);
+    M_TEST_T(step.has_value(), "promoted runs right away");
+    M_TEST_T(std::abs(step.value() - 2.f * dt) < 0.0001f,
+             "promoted gets the skipped tick too");
+}
+
+inline void test_sim_lod_patience_is_exact() {
+    constexpr float dt = 1.f / 120.f;
+    HasPatience patience;
+    patience.update_max(10.f);
+    patience.enable();
+    patience.lod.reduce(0);
+
+    // Mid interval, the pending time still shows up in pct
+    (void) patience.lod.step(dt);
+    M_TEST_T(std::abs(patience.amount_left() - (10.f - dt)) < 0.0001f,
+             "pending time counts against patience");
+
+    patience.disable();
+    M_TEST_T(!patience.lod.is_reduced(), "disable goes back to full rate");
+    M_TEST_T(std::abs(patience.amount_left() - (10.f - dt)) < 0.0001f,
+             "disable keeps the time that already went by");
+}
+
+inline void test_sim_lod() {
+    test_sim_lod_reduced_rate_keeps_time();
+    test_sim_lod_patience_is_exact();
+}
+
+}  // namespace tests
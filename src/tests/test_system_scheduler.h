@@ -0,0 +1,62 @@
+#pragma once
+
+#include "../components/has_patience.h"
+#include "../components/is_bank.h"
+#include "../components/transform.h"
+#include "../engine/job_pool.h"
+#include "../system/core/system_scheduler.h"
+
+namespace tests {
+
+inline void test_system_access_conflicts() {
+    SystemAccess patience = SystemAccess{}.writes<HasPatience>();
+    SystemAccess bank = SystemAccess{}.writes<IsBank>();
+    SystemAccess reads_transform = SystemAccess{}.reads<Transform>();
+    SystemAccess writes_transform = SystemAccess{}.writes<Transform>();
+
+    M_TEST_T(!patience.conflicts_with(bank), "disjoint writes dont conflict");
+    M_TEST_T(!reads_transform.conflicts_with(reads_transform),
+             "two readers dont conflict");
+    M_TEST_T(reads_transform.conflicts_with(writes_transform),
+             "reader conflicts with writer");
+    M_TEST_T(writes_transform.conflicts_with(reads_transform),
+             "writer conflicts with reader");
+}
+
+inline void test_system_waves() {
+    SystemAccess patience = SystemAccess{}.writes<HasPatience>();
+    SystemAccess bank = SystemAccess{}.writes<IsBank>();
+    SystemAccess also_patience =
+        SystemAccess{}.reads<HasPatience>().writes<Transform>();
+
+    std::vector<int> waves =
+        ParallelSystemBatch::build_waves({&patience, &bank, &also_patience});
+    M_TEST_EQ(waves[0], 0, "first system starts right away");
+    M_TEST_EQ(waves[1], 0, "disjoint system shares the first wave");
+    M_TEST_EQ(waves[2], 1, "conflicting system waits for the earlier one");
+
+    waves = ParallelSystemBatch::build_waves({nullptr, &bank, &also_patience});
+    M_TEST_EQ(waves[0], -1, "systems that are not running get no wave");
+    M_TEST_EQ(waves[2], 0, "nothing to wait for when the writer is skipped");
+}
+
+inline void test_job_pool() {
+    JobPool pool(2);
+    std::vector<int> results(16, 0);
+    std::vector<std::function<void()>> jobs;
+    for (size_t i = 0; i < results.size(); i++) {
+        jobs.emplace_back([&results, i]() { results[i] = (int) i * 2; });
+    }
+    pool.run(jobs);
+    for (size_t i = 0; i < results.size(); i++) {
+        M_TEST_EQ(results[i], (int) i * 2, "every job should have run");
+    }
+}
+
+inline void test_system_scheduler() {
+    test_system_access_conflicts();
+    test_system_waves();
+    test_job_pool();
+}
+
+}  // namespace tests
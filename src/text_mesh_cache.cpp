@@ -0,0 +1,250 @@
+#include "text_mesh_cache.h"
+
+#include <cstring>
+#include <limits>
+
+#include "engine/settings.h"
+#include "engine/tracy.h"
+#include "libraries/shader_library.h"
+
+namespace {
+
+struct TextMeshBuffers {
+    std::vector<float> vertices;
+    std::vector<float> normals;
+    std::vector<float> texcoords;
+    std::vector<unsigned short> indices;
+
+    [[nodiscard]] size_t vertex_count() const { return vertices.size() / 3; }
+
+    void add_quad(const std::array<vec3, 4>& corners,
+                  const std::array<vec2, 4>& uvs, vec3 normal) {
+        unsigned short base = static_cast<unsigned short>(vertex_count());
+        for (size_t i = 0; i < 4; i++) {
+            vertices.insert(vertices.end(),
+                            {corners[i].x, corners[i].y, corners[i].z});
+            normals.insert(normals.end(), {normal.x, normal.y, normal.z});
+            texcoords.insert(texcoords.end(), {uvs[i].x, uvs[i].y});
+        }
+        indices.insert(indices.end(),
+                       {base, static_cast<unsigned short>(base + 1),
+                        static_cast<unsigned short>(base + 2), base,
+                        static_cast<unsigned short>(base + 2),
+                        static_cast<unsigned short>(base + 3)});
+    }
+};
+
+// Matches the quad that raylib::DrawTextCodepoint3D emits
+void add_codepoint(TextMeshBuffers& buffers, raylib::Font font, int codepoint,
+                   vec3 position, float fontSize, bool backface) {
+    int index = raylib::GetGlyphIndex(font, codepoint);
+    float scale = fontSize / (float) font.baseSize;
+
+    position.x += (float) (font.glyphs[index].offsetX - font.glyphPadding) /
+                  (float) font.baseSize * scale;
+    position.z += (float) (font.glyphs[index].offsetY - font.glyphPadding) /
+                  (float) font.baseSize * scale;
+
+    Rectangle srcRec = {font.recs[index].x - (float) font.glyphPadding,
+                        font.recs[index].y - (float) font.glyphPadding,
+                        font.recs[index].width + 2.0f * font.glyphPadding,
+                        font.recs[index].height + 2.0f * font.glyphPadding};
+
+    float width = srcRec.width / (float) font.baseSize * scale;
+    float height = srcRec.height / (float) font.baseSize * scale;
+
+    const float tx = srcRec.x / font.texture.width;
+    const float ty = srcRec.y / font.texture.height;
+    const float tw = (srcRec.x + srcRec.width) / font.texture.width;
+    const float th = (srcRec.y + srcRec.height) / font.texture.height;
+
+    const vec3 top_left = position;
+    const vec3 bottom_left = position + vec3{0, 0, height};
+    const vec3 bottom_right = position + vec3{width, 0, height};
+    const vec3 top_right = position + vec3{width, 0, 0};
+
+    buffers.add_quad({top_left, bottom_left, bottom_right, top_right},
+                     {vec2{tx, ty}, vec2{tx, th}, vec2{tw, th}, vec2{tw, ty}},
+                     vec3{0, 1, 0});
+
+    if (backface) {
+        buffers.add_quad(
+            {top_left, top_right, bottom_right, bottom_left},
+            {vec2{tx, ty}, vec2{tw, ty}, vec2{tw, th}, vec2{tx, th}},
+            vec3{0, -1, 0});
+    }
+}
+
+// Same layout loop as raylib::DrawText3D, positions are relative to the
+// config position which is applied as the mesh transform
+TextMeshBuffers build_text_buffers(const raylib::DrawTextConfig& config) {
+    TextMeshBuffers buffers;
+    const raylib::Font& font = config.font;
+    const std::string& text = config.text;
+
+    unsigned int length = raylib::TextLength(text.c_str());
+    float textOffsetY = 0.0f;
+    float textOffsetX = 0.0f;
+    float scale = config.fontSize / (float) font.baseSize;
+
+    for (unsigned int i = 0; i < length;) {
+        int codepointByteCount = 0;
+        int codepoint = raylib::GetCodepoint(&text[i], &codepointByteCount);
+        int index = raylib::GetGlyphIndex(font, codepoint);
+
+        if (codepoint == 0x3f) codepointByteCount = 1;
+
+        if (codepoint == '\n') {
+            textOffsetY +=
+                scale + config.lineSpacing / (float) font.baseSize * scale;
+            textOffsetX = 0.0f;
+        } else {
+            if ((codepoint != ' ') && (codepoint != '\t')) {
+                add_codepoint(buffers, font, codepoint,
+                              vec3{textOffsetX, 0.f, textOffsetY},
+                              config.fontSize, config.backface);
+            }
+
+            float advance = font.glyphs[index].advanceX == 0
+                                ? (float) font.recs[index].width
+                                : (float) font.glyphs[index].advanceX;
+            textOffsetX += (advance + config.fontSpacing) /
+                           (float) font.baseSize * scale;
+        }
+
+        i += codepointByteCount;
+    }
+    return buffers;
+}
+
+template<typename T>
+T* copy_to_raylib(const std::vector<T>& data) {
+    T* out = static_cast<T*>(
+        raylib::MemAlloc(static_cast<unsigned int>(sizeof(T) * data.size())));
+    std::memcpy(out, data.data(), sizeof(T) * data.size());
+    return out;
+}
+
+}  // namespace
+
+size_t TextMeshCache::KeyHash::operator()(const Key& key) const {
+    size_t h = std::hash<std::string>{}(key.text);
+    const auto combine = [&h](size_t v) {
+        h ^= v + 0x9e3779b9 + (h << 6) + (h >> 2);
+    };
+    combine(std::hash<unsigned int>{}(key.texture_id));
+    combine(std::hash<int>{}(key.base_size));
+    combine(std::hash<float>{}(key.font_size));
+    combine(std::hash<float>{}(key.font_spacing));
+    combine(std::hash<float>{}(key.line_spacing));
+    combine(std::hash<bool>{}(key.backface));
+    return h;
+}
+
+TextMeshCache::Entry& TextMeshCache::fetch(
+    const raylib::DrawTextConfig& config) {
+    Key key{
+        .texture_id = config.font.texture.id,
+        .base_size = config.font.baseSize,
+        .text = config.text,
+        .font_size = config.fontSize,
+        .font_spacing = config.fontSpacing,
+        .line_spacing = config.lineSpacing,
+        .backface = config.backface,
+    };
+
+    auto it = entries.find(key);
+    if (it != entries.end()) {
+        hits++;
+        lru.splice(lru.begin(), lru, it->second.lru_it);
+        return it->second;
+    }
+
+    TRACY_ZONE_SCOPED;
+    misses++;
+    if (entries.size() >= MAX_ENTRIES) evict_oldest();
+
+    Entry entry;
+    TextMeshBuffers buffers = build_text_buffers(config);
+    if (!buffers.indices.empty()) {
+        raylib::Mesh& mesh = entry.mesh;
+        mesh.vertexCount = static_cast<int>(buffers.vertex_count());
+        mesh.triangleCount = static_cast<int>(buffers.indices.size() / 3);
+        mesh.vertices = copy_to_raylib(buffers.vertices);
+        mesh.normals = copy_to_raylib(buffers.normals);
+        mesh.texcoords = copy_to_raylib(buffers.texcoords);
+        mesh.indices = copy_to_raylib(buffers.indices);
+        raylib::UploadMesh(&mesh, false);
+        entry.has_mesh = true;
+    }
+
+    lru.push_front(key);
+    entry.lru_it = lru.begin();
+    return entries.emplace(std::move(key), entry).first->second;
+}
+
+void TextMeshCache::evict_oldest() {
+    if (lru.empty()) return;
+    auto it = entries.find(lru.back());
+    if (it != entries.end()) {
+        if (it->second.has_mesh) raylib::UnloadMesh(it->second.mesh);
+        entries.erase(it);
+    }
+    lru.pop_back();
+}
+
+void TextMeshCache::draw(const raylib::DrawTextConfig& config) {
+    if (config.font.texture.id == 0) return;
+
+    // unsigned short indices, 8 verts per glyph with backfaces
+    if (config.text.size() * 8 >= std::numeric_limits<unsigned short>::max()) {
+        raylib::DrawText3D(config);
+        return;
+    }
+
+    const Entry& entry = fetch(config);
+    if (!entry.has_mesh) return;
+
+    auto material_it = materials.find(config.font.texture.id);
+    if (material_it == materials.end()) {
+        raylib::Material material = raylib::LoadMaterialDefault();
+        material.maps[raylib::MATERIAL_MAP_DIFFUSE].texture =
+            config.font.texture;
+        material_it =
+            materials.emplace(config.font.texture.id, material).first;
+    }
+
+    raylib::Material& material = material_it->second;
+    material.maps[raylib::MATERIAL_MAP_DIFFUSE].color = config.color;
+
+    // DrawMesh uses the material shader, not the active shader mode, so
+    // pick what DrawText3D would have been drawn with
+    raylib::Shader shader{};
+    if (Settings::get().data.enable_lighting) {
+        shader = ShaderLibrary::get().get("lighting");
+    } else {
+        shader.id = raylib::rlGetShaderIdDefault();
+        shader.locs = raylib::rlGetShaderLocsDefault();
+    }
+    material.shader = shader;
+
+    raylib::DrawMesh(entry.mesh, material,
+                     raylib::MatrixTranslate(config.position.x,
+                                             config.position.y,
+                                             config.position.z));
+}
+
+void TextMeshCache::unload_all() {
+    for (auto& [key, entry] : entries) {
+        if (entry.has_mesh) raylib::UnloadMesh(entry.mesh);
+    }
+    entries.clear();
+    lru.clear();
+
+    // The font owns the texture, so only free the map array
+    // (UnloadMaterial would unload the font texture too)
+    for (auto& [id, material] : materials) {
+        raylib::MemFree(material.maps);
+    }
+    materials.clear();
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <list>
+#include <unordered_map>
+
+#include "engine/singleton.h"
+#include "external_include.h"
+#include "text_util.h"
+
+// Caches the glyph quads that DrawText3D would emit as one uploaded mesh per
+// string so static labels (names, prices, machine names) dont rebuild and
+// re-submit every codepoint every frame.
+//
+// Entries are keyed on the font, the string and the layout style and are
+// evicted least-recently-used once we go over MAX_ENTRIES.
+//
+// Wave text is not cached since every glyph moves every frame.
+SINGLETON_FWD(TextMeshCache)
+struct TextMeshCache {
+    SINGLETON(TextMeshCache)
+
+    static constexpr size_t MAX_ENTRIES = 512;
+
+    // Same output as raylib::DrawText3D(config)
+    void draw(const raylib::DrawTextConfig& config);
+
+    void unload_all();
+
+    [[nodiscard]] size_t size() const { return entries.size(); }
+    [[nodiscard]] size_t num_hits() const { return hits; }
+    [[nodiscard]] size_t num_misses() const { return misses; }
+
+   private:
+    struct Key {
+        unsigned int texture_id = 0;
+        int base_size = 0;
+        std::string text;
+        float font_size = 0.f;
+        float font_spacing = 0.f;
+        float line_spacing = 0.f;
+        bool backface = false;
+
+        bool operator==(const Key& other) const = default;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct Entry {
+        raylib::Mesh mesh{};
+        // empty strings or strings of only whitespace have nothing to draw
+        bool has_mesh = false;
+        std::list<Key>::iterator lru_it;
+    };
+
+    Entry& fetch(const raylib::DrawTextConfig& config);
+    void evict_oldest();
+
+    std::list<Key> lru;
+    std::unordered_map<Key, Entry, KeyHash> entries;
+    std::unordered_map<unsigned int, raylib::Material> materials;
+
+    size_t hits = 0;
+    size_t misses = 0;
+};